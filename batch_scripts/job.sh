@@ -13,6 +13,37 @@ user=$(whoami)
 mkdir /scratch/$user/$5/ -p
 tmp=/scratch/$user/$5/"output_$2_$3_${SLURM_ARRAY_TASK_ID}.root"
 dst=$1/"output_$2_$3_${SLURM_ARRAY_TASK_ID}.root"
+#shard of the counter-based random streams (/Xe/random/), tasks 1..N
+export XE_FIRST_EVENT=$(( (SLURM_ARRAY_TASK_ID - 1) * $4 ))
 source /opt/geant/v10.3.3/bin/geant4.sh && source /opt/geant/v10.3.3/share/Geant4-10.3.3/geant4make/geant4make.sh && export G4WORKDIR=.
-./bin/Linux-g++/xenon1t_G4p10 -p /users/arocchetti/mc/macros/XENONnT/preinit_TPC.mac -f $1/"run_ER_$2_$3.mac" -n $4 -o $tmp -d XENONnT
-mv $tmp $dst
+#checkpoint of the task (/Xe/checkpoint/), a requeued or retried task
+#continues from it and appends to $tmp; without checkpoints no retry
+export XE_CHECKPOINT=$tmp.checkpoint
+#PreInit-only settings written by make_macros.py, on top of preinit_TPC.mac
+preinit=/users/arocchetti/mc/macros/XENONnT/preinit_TPC.mac
+[ -f $1/preinit_ER.mac ] && preinit=$1/preinit_ER.mac
+#a task is complete when its checkpoint counts all the events and its output
+#opens with the events tree, whatever the exit status (a crash at teardown
+#loses nothing); without checkpoints the exit status decides
+complete() {
+if [ -f $XE_CHECKPOINT ]; then
+[ "$(awk '$1 == "completed" {print $2}' $XE_CHECKPOINT)" = "$1" ] || return 1
+else
+[ $status -eq 0 ] || return 1
+fi
+root -l -b -q -e "TFile f(\"$tmp\"); if (f.IsZombie() || !f.Get(\"events/events\")) gSystem->Exit(1);" > /dev/null 2>&1
+}
+attempts=1
+grep -q "^/Xe/checkpoint/resume true" $1/"run_ER_$2_$3.mac" && attempts=3
+status=1
+for attempt in $(seq $attempts); do
+./bin/Linux-g++/xenon1t_G4p10 -p $preinit -f $1/"run_ER_$2_$3.mac" -n $4 -o $tmp -d XENONnT
+status=$?
+complete $4 && break
+done
+#an incomplete task keeps its partial output and checkpoint for a resubmission
+if ! complete $4; then
+echo "task ${SLURM_ARRAY_TASK_ID} incomplete after $attempts attempts (exit status $status), $tmp and $XE_CHECKPOINT kept" >&2
+exit 1
+fi
+mv $tmp $dst && rm -f $XE_CHECKPOINT
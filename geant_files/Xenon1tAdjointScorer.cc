@@ -0,0 +1,224 @@
+// XENON Header Files
+#include "Xenon1tAdjointScorer.hh"
+#include "Xenon1tAdjointScorerMessenger.hh"
+#include "Xenon1tGeometryUtilities.hh"
+
+// Additional Header Files
+#include <cmath>
+#include <sstream>
+
+// Root Header Files
+#include "TFile.h"
+#include "TH1D.h"
+#include "TParameter.h"
+
+// G4 Header Files
+#include <G4AutoLock.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4Step.hh>
+#include <G4StepPoint.hh>
+#include <G4Threading.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tAdjointScorer *Xenon1tAdjointScorer::m_pInstance = 0;
+G4ThreadLocal vector<G4double> *Xenon1tAdjointScorer::m_pTrackLength = 0;
+
+namespace {
+G4Mutex hAdjointScorerMutex = G4MUTEX_INITIALIZER;
+}
+
+Xenon1tAdjointScorer *Xenon1tAdjointScorer::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tAdjointScorer();
+  return m_pInstance;
+}
+
+Xenon1tAdjointScorer::Xenon1tAdjointScorer() {
+  m_bActive = false;
+  m_hFileName = "adjoint_response.root";
+  m_dEnergyMin = 10. * keV;
+  m_dEnergyMax = 10. * MeV;
+  m_iBins = 300;
+  m_bVolumeMapReady = false;
+
+  m_pMessenger = new Xenon1tAdjointScorerMessenger(this);
+}
+
+Xenon1tAdjointScorer::~Xenon1tAdjointScorer() { delete m_pMessenger; }
+
+void Xenon1tAdjointScorer::AddComponent(const G4String &hComponent) {
+  m_hComponents.push_back(hComponent);
+  m_bVolumeMapReady = false;
+}
+
+void Xenon1tAdjointScorer::ClearComponents() {
+  m_hComponents.clear();
+  m_bVolumeMapReady = false;
+}
+
+void Xenon1tAdjointScorer::SetEnergyBinning(G4double dEnergyMin,
+                                            G4double dEnergyMax,
+                                            G4int iBins) {
+  if (dEnergyMin <= 0. || dEnergyMax <= dEnergyMin || iBins < 1)
+    G4Exception("Xenon1tAdjointScorer::SetEnergyBinning()", "AdjointScorer",
+                FatalException, "Invalid energy binning");
+  m_dEnergyMin = dEnergyMin;
+  m_dEnergyMax = dEnergyMax;
+  m_iBins = iBins;
+  m_bVolumeMapReady = false;
+}
+
+void Xenon1tAdjointScorer::BuildVolumeMap() {
+  // the first thread to score builds the map for all of them
+  G4AutoLock hLock(&hAdjointScorerMutex);
+  if (m_bVolumeMapReady) return;
+
+  m_hVolumeMap.clear();
+  m_hComponentVolumes.assign(m_hComponents.size(), 0.);
+
+  for (size_t i = 0; i < m_hComponents.size(); i++) {
+    // a component is one or more volume names, as /xe/gun/confine
+    vector<Xenon1tGeometryUtilities::Placement> hPlacements;
+    std::istringstream hStream(m_hComponents[i]);
+    G4String hVolume;
+    while (hStream >> hVolume) {
+      vector<Xenon1tGeometryUtilities::Placement> hMatches =
+          Xenon1tGeometryUtilities::FindPlacements(hVolume);
+      if (hMatches.empty())
+        G4Exception("Xenon1tAdjointScorer::BuildVolumeMap()", "AdjointScorer",
+                    FatalException, ("No volume matches " + hVolume).c_str());
+      hPlacements.insert(hPlacements.end(), hMatches.begin(), hMatches.end());
+    }
+
+    for (size_t j = 0; j < hPlacements.size(); j++) {
+      const G4VPhysicalVolume *pVolume = hPlacements[j].pVolume;
+      // the first component claiming a volume keeps it
+      if (m_hVolumeMap.count(pVolume)) continue;
+      m_hVolumeMap[pVolume] = (G4int)i;
+      // the volume of the material only, the daughters are taken out
+      G4LogicalVolume *pLogicalVolume = pVolume->GetLogicalVolume();
+      m_hComponentVolumes[i] += pLogicalVolume->GetMass(false, false) /
+                                pLogicalVolume->GetMaterial()->GetDensity();
+    }
+  }
+
+  for (size_t i = 0; i < m_hThreadTrackLengths.size(); i++)
+    m_hThreadTrackLengths[i]->assign(m_hComponents.size() * 2 * m_iBins, 0.);
+  m_bVolumeMapReady = true;
+}
+
+G4int Xenon1tAdjointScorer::GetEnergyBin(G4double dEnergy) const {
+  if (dEnergy < m_dEnergyMin || dEnergy >= m_dEnergyMax) return -1;
+  return (G4int)(m_iBins * std::log(dEnergy / m_dEnergyMin) /
+                 std::log(m_dEnergyMax / m_dEnergyMin));
+}
+
+void Xenon1tAdjointScorer::Process(const G4Step *pStep) {
+  if (!m_bActive) return;
+  if (!m_bVolumeMapReady) BuildVolumeMap();
+  if (!m_pTrackLength) {
+    G4AutoLock hLock(&hAdjointScorerMutex);
+    m_pTrackLength =
+        new vector<G4double>(m_hComponents.size() * 2 * m_iBins, 0.);
+    m_hThreadTrackLengths.push_back(m_pTrackLength);
+  }
+
+  const G4String &hParticle =
+      pStep->GetTrack()->GetDefinition()->GetParticleName();
+  G4int iParticle;
+  if (hParticle == "adj_gamma")
+    iParticle = 0;
+  else if (hParticle == "adj_e-")
+    iParticle = 1;
+  else
+    return;
+
+  const G4StepPoint *pPreStepPoint = pStep->GetPreStepPoint();
+  map<const G4VPhysicalVolume *, G4int>::const_iterator pIt =
+      m_hVolumeMap.find(pPreStepPoint->GetPhysicalVolume());
+  if (pIt == m_hVolumeMap.end()) return;
+
+  // adjoint particles gain energy along the step, score at its mid-point
+  const G4double dEnergy = 0.5 * (pPreStepPoint->GetKineticEnergy() +
+                                  pStep->GetPostStepPoint()->GetKineticEnergy());
+  const G4int iBin = GetEnergyBin(dEnergy);
+  if (iBin < 0) return;
+
+  (*m_pTrackLength)[(pIt->second * 2 + iParticle) * m_iBins + iBin] +=
+      pPreStepPoint->GetWeight() * pStep->GetStepLength();
+}
+
+void Xenon1tAdjointScorer::Write(G4int iNumberOfEvents) {
+  if (!m_bActive || !m_bVolumeMapReady || G4Threading::IsWorkerThread())
+    return;
+  if (iNumberOfEvents <= 0) {
+    G4Exception("Xenon1tAdjointScorer::Write()", "AdjointScorer", JustWarning,
+                ("No adjoint events, " + m_hFileName + " not written").c_str());
+    return;
+  }
+
+  // the workers are done at the end of the run
+  vector<G4double> hTrackLength(m_hComponents.size() * 2 * m_iBins, 0.);
+  for (size_t i = 0; i < m_hThreadTrackLengths.size(); i++)
+    for (size_t j = 0; j < hTrackLength.size(); j++)
+      hTrackLength[j] += (*m_hThreadTrackLengths[i])[j];
+
+  TFile *pFile = new TFile(m_hFileName.c_str(), "RECREATE");
+
+  vector<G4double> hBinEdges(m_iBins + 1);
+  for (G4int i = 0; i <= m_iBins; i++)
+    hBinEdges[i] = m_dEnergyMin *
+                   std::pow(m_dEnergyMax / m_dEnergyMin, (G4double)i / m_iBins) /
+                   keV;
+
+  TParameter<int> *pEventsPar =
+      new TParameter<int>("NumberOfAdjointEvents", iNumberOfEvents);
+  pEventsPar->Write();
+
+  const char *hParticles[2] = {"gamma", "e-"};
+  for (size_t i = 0; i < m_hComponents.size(); i++) {
+    // named after its first volume
+    G4String hComponent;
+    std::istringstream(m_hComponents[i]) >> hComponent;
+    if (hComponent[hComponent.length() - 1] == '*')
+      hComponent.erase(hComponent.length() - 1);
+
+    for (G4int iParticle = 0; iParticle < 2; iParticle++) {
+      const G4String hName = hComponent + "_" + hParticles[iParticle];
+      TH1D *pHistogram =
+          new TH1D(hName.c_str(), (hName + ";E [keV];adjoint flux [1/cm^2]")
+                                      .c_str(),
+                   m_iBins, &hBinEdges[0]);
+      for (G4int iBin = 0; iBin < m_iBins; iBin++) {
+        const G4double dTrackLength =
+            hTrackLength[(i * 2 + iParticle) * m_iBins + iBin];
+        pHistogram->SetBinContent(
+            iBin + 1, dTrackLength / m_hComponentVolumes[i] /
+                          iNumberOfEvents * cm2);
+      }
+      pHistogram->Write();
+    }
+
+    TParameter<double> *pVolumePar = new TParameter<double>(
+        (hComponent + "_Volume").c_str(), m_hComponentVolumes[i] / cm3);
+    pVolumePar->Write();
+  }
+
+  pFile->Close();
+  delete pFile;
+
+  G4cout << "Xenon1tAdjointScorer: responses of " << m_hComponents.size()
+         << " components from " << iNumberOfEvents << " adjoint events written"
+         << " to " << m_hFileName << G4endl;
+}
+
+void Xenon1tAdjointScorer::Reset() {
+  G4AutoLock hLock(&hAdjointScorerMutex);
+  for (size_t i = 0; i < m_hThreadTrackLengths.size(); i++)
+    m_hThreadTrackLengths[i]->assign(m_hThreadTrackLengths[i]->size(), 0.);
+}
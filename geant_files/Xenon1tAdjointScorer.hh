@@ -0,0 +1,87 @@
+#ifndef __XENON1TADJOINTSCORER_H__
+#define __XENON1TADJOINTSCORER_H__
+
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+class Xenon1tAdjointScorerMessenger;
+class G4Step;
+class G4VPhysicalVolume;
+
+// Scoring for the reverse Monte Carlo mode (G4AdjointSimManager). The
+// adjoint gammas and electrons start on the surface of the LXe volume and
+// are tracked backward out to the external source surface (set with the
+// /adjoint/ commands). On the way, the track length of every adjoint
+// particle in each registered source component is tallied as a function of
+// its energy:
+//
+//   S_c(E) = sum w * l / V_c   [per adjoint event, per energy bin]
+//
+// which is the adjoint flux averaged over component c, V_c being the volume
+// of its material (daughter volumes excluded); a component is made of the
+// volumes simulated together in the forward macros (/xe/gun/confine).
+// Folding S_c(E) with the line intensities of an isotope, and the adjoint
+// source normalisation of G4AdjointSimManager, gives the response of the
+// LXe volume to that isotope uniformly distributed in c. The FV cut is
+// applied as usual to the forward hits of the same run, which are the
+// cross-check of this estimate.
+//
+// The adjoint stepping action calls Process() for every step and the run
+// action calls Write() at the end of the adjoint run. The settings and the
+// volume map are shared by all threads; every thread tallies in its own
+// array, and Write() on the master sums them.
+
+class Xenon1tAdjointScorer {
+ public:
+  static Xenon1tAdjointScorer *GetInstance();
+  ~Xenon1tAdjointScorer();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void AddComponent(const G4String &hComponent);
+  void ClearComponents();
+  void SetEnergyBinning(G4double dEnergyMin, G4double dEnergyMax,
+                        G4int iBins);
+  void SetFileName(const G4String &hFileName) { m_hFileName = hFileName; }
+
+  void Process(const G4Step *pStep);
+
+  void Write(G4int iNumberOfEvents);
+  void Reset();
+
+ private:
+  Xenon1tAdjointScorer();
+
+  void BuildVolumeMap();
+  G4int GetEnergyBin(G4double dEnergy) const;
+
+  static Xenon1tAdjointScorer *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hFileName;
+
+  // log binning
+  G4double m_dEnergyMin;
+  G4double m_dEnergyMax;
+  G4int m_iBins;
+
+  vector<G4String> m_hComponents;
+  vector<G4double> m_hComponentVolumes;
+  map<const G4VPhysicalVolume *, G4int> m_hVolumeMap;
+  G4bool m_bVolumeMapReady;
+
+  // [component][particle][bin], particle 0 = adj_gamma, 1 = adj_e-, one
+  // per thread, all of them listed for the merge
+  static G4ThreadLocal vector<G4double> *m_pTrackLength;
+  vector<vector<G4double> *> m_hThreadTrackLengths;
+
+  Xenon1tAdjointScorerMessenger *m_pMessenger;
+};
+
+#endif
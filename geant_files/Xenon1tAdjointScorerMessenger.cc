@@ -0,0 +1,93 @@
+// XENON Header Files
+#include "Xenon1tAdjointScorerMessenger.hh"
+#include "Xenon1tAdjointScorer.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tAdjointScorerMessenger::Xenon1tAdjointScorerMessenger(
+    Xenon1tAdjointScorer *pScorer)
+    : m_pScorer(pScorer) {
+  m_pAdjointDir = new G4UIdirectory("/Xe/adjoint/");
+  m_pAdjointDir->SetGuidance("Per-component scoring of the reverse Monte "
+                             "Carlo mode (sources set with /adjoint/).");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/adjoint/setActive", this);
+  m_pActiveCmd->SetGuidance("Score the adjoint flux in the components.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pComponentCmd = new G4UIcmdWithAString("/Xe/adjoint/component", this);
+  m_pComponentCmd->SetGuidance("Add a source component: one or more physical "
+                               "volumes (trailing * matches a prefix), as "
+                               "/xe/gun/confine; named after the first.");
+  m_pComponentCmd->SetParameterName("component", false);
+  m_pComponentCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd =
+      new G4UIcmdWithoutParameter("/Xe/adjoint/clearComponents", this);
+  m_pClearCmd->SetGuidance("Remove all components.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pBinningCmd = new G4UIcommand("/Xe/adjoint/energyBinning", this);
+  m_pBinningCmd->SetGuidance("Logarithmic energy binning: Emin Emax bins "
+                             "unit.");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("Emin", 'd', false);
+  m_pBinningCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("Emax", 'd', false);
+  m_pBinningCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("bins", 'i', false);
+  pParameter->SetParameterRange("bins > 0");
+  m_pBinningCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("keV");
+  m_pBinningCmd->SetParameter(pParameter);
+  m_pBinningCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pFileCmd = new G4UIcmdWithAString("/Xe/adjoint/file", this);
+  m_pFileCmd->SetGuidance("Output ROOT file of the responses.");
+  m_pFileCmd->SetParameterName("file", false);
+  m_pFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tAdjointScorerMessenger::~Xenon1tAdjointScorerMessenger() {
+  delete m_pActiveCmd;
+  delete m_pComponentCmd;
+  delete m_pClearCmd;
+  delete m_pBinningCmd;
+  delete m_pFileCmd;
+  delete m_pAdjointDir;
+}
+
+void Xenon1tAdjointScorerMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pScorer->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pComponentCmd) m_pScorer->AddComponent(hNewValue);
+
+  if (pUIcommand == m_pClearCmd) m_pScorer->ClearComponents();
+
+  if (pUIcommand == m_pBinningCmd) {
+    G4double dEnergyMin, dEnergyMax;
+    G4int iBins;
+    G4String hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> dEnergyMin >> dEnergyMax >> iBins >> hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pScorer->SetEnergyBinning(dEnergyMin * dUnit, dEnergyMax * dUnit, iBins);
+  }
+
+  if (pUIcommand == m_pFileCmd) m_pScorer->SetFileName(hNewValue);
+}
@@ -0,0 +1,32 @@
+#ifndef __XENON1TADJOINTSCORERMESSENGER_H__
+#define __XENON1TADJOINTSCORERMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tAdjointScorer;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tAdjointScorerMessenger : public G4UImessenger {
+ public:
+  Xenon1tAdjointScorerMessenger(Xenon1tAdjointScorer *pScorer);
+  ~Xenon1tAdjointScorerMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tAdjointScorer *m_pScorer;
+
+  G4UIdirectory *m_pAdjointDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pComponentCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcommand *m_pBinningCmd;
+  G4UIcmdWithAString *m_pFileCmd;
+};
+
+#endif
@@ -0,0 +1,58 @@
+// XENON Header Files
+#include "Xenon1tAliasTable.hh"
+
+// G4 Header Files
+#include <Randomize.hh>
+
+void Xenon1tAliasTable::Build(const vector<G4double> &hWeights) {
+  const G4int iSize = (G4int)hWeights.size();
+  m_hProbabilities.assign(iSize, 1.);
+  m_hAliases.resize(iSize);
+
+  m_dTotalWeight = 0.;
+  for (G4int i = 0; i < iSize; i++) {
+    if (hWeights[i] < 0.)
+      G4Exception("Xenon1tAliasTable::Build()", "AliasTable", FatalException,
+                  "Negative weight");
+    m_dTotalWeight += hWeights[i];
+    m_hAliases[i] = i;
+  }
+  if (m_dTotalWeight <= 0.)
+    G4Exception("Xenon1tAliasTable::Build()", "AliasTable", FatalException,
+                "No positive weight");
+
+  vector<G4double> hScaled(iSize);
+  vector<G4int> hSmall, hLarge;
+  for (G4int i = 0; i < iSize; i++) {
+    hScaled[i] = hWeights[i] * iSize / m_dTotalWeight;
+    if (hScaled[i] < 1.)
+      hSmall.push_back(i);
+    else
+      hLarge.push_back(i);
+  }
+
+  while (!hSmall.empty() && !hLarge.empty()) {
+    const G4int iSmall = hSmall.back();
+    const G4int iLarge = hLarge.back();
+    hSmall.pop_back();
+
+    m_hProbabilities[iSmall] = hScaled[iSmall];
+    m_hAliases[iSmall] = iLarge;
+
+    hScaled[iLarge] -= 1. - hScaled[iSmall];
+    if (hScaled[iLarge] < 1.) {
+      hLarge.pop_back();
+      hSmall.push_back(iLarge);
+    }
+  }
+  // whatever is left is 1 up to rounding
+}
+
+G4int Xenon1tAliasTable::Sample() const { return Sample(G4UniformRand()); }
+
+G4int Xenon1tAliasTable::Sample(G4double dRandom) const {
+  const G4double dScaled = dRandom * m_hProbabilities.size();
+  G4int iBin = (G4int)dScaled;
+  if (iBin >= (G4int)m_hProbabilities.size()) iBin--;
+  return (dScaled - iBin < m_hProbabilities[iBin]) ? iBin : m_hAliases[iBin];
+}
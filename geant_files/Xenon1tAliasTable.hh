@@ -0,0 +1,33 @@
+#ifndef __XENON1TALIASTABLE_H__
+#define __XENON1TALIASTABLE_H__
+
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+// Walker alias table: O(1) sampling of an index from a fixed discrete
+// distribution with one uniform random number, built in O(n) (Vose).
+
+class Xenon1tAliasTable {
+ public:
+  Xenon1tAliasTable() : m_dTotalWeight(0.) { ; }
+  Xenon1tAliasTable(const vector<G4double> &hWeights) { Build(hWeights); }
+
+  void Build(const vector<G4double> &hWeights);
+
+  G4int Sample() const;
+  // with a given uniform number, e.g. a quasi-random coordinate
+  G4int Sample(G4double dRandom) const;
+
+  G4int GetSize() const { return (G4int)m_hProbabilities.size(); }
+  G4double GetTotalWeight() const { return m_dTotalWeight; }
+
+ private:
+  vector<G4double> m_hProbabilities;
+  vector<G4int> m_hAliases;
+  G4double m_dTotalWeight;
+};
+
+#endif
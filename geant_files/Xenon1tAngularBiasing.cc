@@ -0,0 +1,139 @@
+// XENON Header Files
+#include "Xenon1tAngularBiasing.hh"
+#include "Xenon1tAngularBiasingMessenger.hh"
+#include "Xenon1tGeometryUtilities.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4LogicalVolume.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4RandomDirection.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <G4VisExtent.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4PhysicalConstants.hh>
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tAngularBiasing *Xenon1tAngularBiasing::m_pInstance = 0;
+
+Xenon1tAngularBiasing *Xenon1tAngularBiasing::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tAngularBiasing();
+  return m_pInstance;
+}
+
+Xenon1tAngularBiasing::Xenon1tAngularBiasing() {
+  m_bActive = false;
+  m_hTargetVolume = "SS_InnerCryostat";
+  m_bTargetReady = false;
+  m_dTargetRadius = 0.;
+  m_dIsotropicFraction = 0.05;
+  m_hParticles.push_back("gamma");
+
+  m_pMessenger = new Xenon1tAngularBiasingMessenger(this);
+}
+
+Xenon1tAngularBiasing::~Xenon1tAngularBiasing() { delete m_pMessenger; }
+
+G4bool Xenon1tAngularBiasing::IsBiased(
+    const G4ParticleDefinition *pDefinition) const {
+  if (!m_bActive) return false;
+  return std::find(m_hParticles.begin(), m_hParticles.end(),
+                   pDefinition->GetParticleName()) != m_hParticles.end();
+}
+
+void Xenon1tAngularBiasing::SetTarget(const G4ThreeVector &hCenter,
+                                      G4double dRadius) {
+  m_hTargetVolume = "";
+  m_hTargetCenter = hCenter;
+  m_dTargetRadius = dRadius;
+  m_bTargetReady = true;
+}
+
+void Xenon1tAngularBiasing::SetTargetVolume(const G4String &hVolume) {
+  m_hTargetVolume = hVolume;
+  m_bTargetReady = false;
+}
+
+void Xenon1tAngularBiasing::SetParticles(const G4String &hParticles) {
+  m_hParticles.clear();
+  istringstream hStream(hParticles);
+  G4String hParticle;
+  while (hStream >> hParticle) m_hParticles.push_back(hParticle);
+}
+
+void Xenon1tAngularBiasing::UpdateTarget() {
+  // bounding sphere of the target volume, resolved once the geometry exists
+  vector<Xenon1tGeometryUtilities::Placement> hPlacements =
+      Xenon1tGeometryUtilities::FindPlacements(m_hTargetVolume);
+  if (hPlacements.size() != 1)
+    G4Exception("Xenon1tAngularBiasing::UpdateTarget()", "AngularBiasing",
+                FatalException,
+                ("Target volume " + m_hTargetVolume +
+                 " must match exactly one placement")
+                    .c_str());
+
+  const G4VisExtent hExtent =
+      hPlacements[0].pVolume->GetLogicalVolume()->GetSolid()->GetExtent();
+  m_hTargetCenter = Xenon1tGeometryUtilities::ToWorld(
+      hPlacements[0].hToWorld, G4ThreeVector(hExtent.GetExtentCenter()));
+  m_dTargetRadius = hExtent.GetExtentRadius();
+  m_bTargetReady = true;
+
+  PrintBiasing();
+}
+
+G4double Xenon1tAngularBiasing::SampleDirection(const G4ThreeVector &hVertex,
+                                                G4ThreeVector &hDirection) {
+  if (!m_bTargetReady) UpdateTarget();
+
+  const G4ThreeVector hAxis = m_hTargetCenter - hVertex;
+  const G4double dDistance = hAxis.mag();
+  if (dDistance <= m_dTargetRadius) {
+    hDirection = G4RandomDirection();
+    return 1.;
+  }
+
+  const G4double dSinMax = m_dTargetRadius / dDistance;
+  const G4double dCosMax = std::sqrt(1. - dSinMax * dSinMax);
+  const G4ThreeVector hUnitAxis = hAxis.unit();
+
+  if (G4UniformRand() < m_dIsotropicFraction) {
+    hDirection = G4RandomDirection();
+  } else {
+    const G4double dCosTheta = 1. - G4UniformRand() * (1. - dCosMax);
+    const G4double dSinTheta =
+        std::sqrt(std::max(0., 1. - dCosTheta * dCosTheta));
+    const G4double dPhi = twopi * G4UniformRand();
+    hDirection = G4ThreeVector(dSinTheta * std::cos(dPhi),
+                               dSinTheta * std::sin(dPhi), dCosTheta);
+    hDirection.rotateUz(hUnitAxis);
+  }
+
+  // the weight depends only on whether the direction ends up in the cone
+  const G4double dConeFraction = 0.5 * (1. - dCosMax);
+  G4double dDensity = m_dIsotropicFraction;
+  if (hDirection.dot(hUnitAxis) >= dCosMax)
+    dDensity += (1. - m_dIsotropicFraction) / dConeFraction;
+  return 1. / dDensity;
+}
+
+void Xenon1tAngularBiasing::PrintBiasing() {
+  G4cout << "Xenon1tAngularBiasing: " << (m_bActive ? "on" : "off")
+         << ", target " << (m_hTargetVolume.empty() ? "sphere" : m_hTargetVolume)
+         << " center = " << m_hTargetCenter / mm
+         << " mm, radius = " << m_dTargetRadius / mm
+         << " mm, isotropic fraction = " << m_dIsotropicFraction
+         << ", particles:";
+  for (size_t i = 0; i < m_hParticles.size(); i++)
+    G4cout << " " << m_hParticles[i];
+  G4cout << G4endl;
+}
@@ -0,0 +1,67 @@
+#ifndef __XENON1TANGULARBIASING_H__
+#define __XENON1TANGULARBIASING_H__
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tAngularBiasingMessenger;
+class G4ParticleDefinition;
+
+// Importance sampling of the emission direction toward a target sphere
+// (by default the bounding sphere of SS_InnerCryostat). Directions are drawn
+// from the mixture
+//
+//   p(u) = f / 4pi + (1 - f) * [u in cone] / (2pi (1 - cos theta_max))
+//
+// with sin(theta_max) = R / d, and every biased particle carries the weight
+// 1 / (4pi p(u)). The isotropic fraction f keeps the weight bounded for
+// directions outside the cone (1 / f), which still reach the xenon by
+// scattering: f = 0 would leave them out and bias the result, f >= 0.01
+// keeps their weights within two orders of magnitude. Vertices inside the
+// target sphere are emitted isotropically with weight 1.
+
+class Xenon1tAngularBiasing {
+ public:
+  static Xenon1tAngularBiasing *GetInstance();
+  ~Xenon1tAngularBiasing();
+
+  G4bool IsActive() const { return m_bActive; }
+  G4bool IsBiased(const G4ParticleDefinition *pDefinition) const;
+
+  // returns the weight of the sampled direction
+  G4double SampleDirection(const G4ThreeVector &hVertex,
+                           G4ThreeVector &hDirection);
+
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetTarget(const G4ThreeVector &hCenter, G4double dRadius);
+  void SetTargetVolume(const G4String &hVolume);
+  void SetIsotropicFraction(G4double dFraction) {
+    m_dIsotropicFraction = dFraction;
+  }
+  void SetParticles(const G4String &hParticles);
+
+  void PrintBiasing();
+
+ private:
+  Xenon1tAngularBiasing();
+
+  void UpdateTarget();
+
+  static G4ThreadLocal Xenon1tAngularBiasing *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hTargetVolume;
+  G4bool m_bTargetReady;
+  G4ThreeVector m_hTargetCenter;
+  G4double m_dTargetRadius;
+  G4double m_dIsotropicFraction;
+  vector<G4String> m_hParticles;
+
+  Xenon1tAngularBiasingMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,110 @@
+// XENON Header Files
+#include "Xenon1tAngularBiasingMessenger.hh"
+#include "Xenon1tAngularBiasing.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4ThreeVector.hh>
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADouble.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tAngularBiasingMessenger::Xenon1tAngularBiasingMessenger(
+    Xenon1tAngularBiasing *pBiasing)
+    : m_pBiasing(pBiasing) {
+  m_pBiasDir = new G4UIdirectory("/xe/gun/bias/");
+  m_pBiasDir->SetGuidance("Directional source biasing toward the TPC.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/xe/gun/bias/setActive", this);
+  m_pActiveCmd->SetGuidance("Sample directions toward the target sphere and "
+                            "weight the events.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTargetCmd = new G4UIcommand("/xe/gun/bias/target", this);
+  m_pTargetCmd->SetGuidance("Explicit target sphere: x y z radius unit.");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("x", 'd', false);
+  m_pTargetCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("y", 'd', false);
+  m_pTargetCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("z", 'd', false);
+  m_pTargetCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("radius", 'd', false);
+  pParameter->SetParameterRange("radius > 0.");
+  m_pTargetCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pTargetCmd->SetParameter(pParameter);
+  m_pTargetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTargetVolumeCmd =
+      new G4UIcmdWithAString("/xe/gun/bias/targetVolume", this);
+  m_pTargetVolumeCmd->SetGuidance("Use the bounding sphere of a physical "
+                                  "volume as target (SS_InnerCryostat).");
+  m_pTargetVolumeCmd->SetParameterName("volume", false);
+  m_pTargetVolumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pIsotropicFractionCmd =
+      new G4UIcmdWithADouble("/xe/gun/bias/isotropicFraction", this);
+  m_pIsotropicFractionCmd->SetGuidance("Fraction of directions still drawn "
+                                       "isotropically (bounds the weight).");
+  m_pIsotropicFractionCmd->SetGuidance("Directions outside the cone weigh "
+                                       "1 / fraction; 0 would drop them, use "
+                                       "at least 0.01 (default 0.05).");
+  m_pIsotropicFractionCmd->SetParameterName("fraction", false);
+  m_pIsotropicFractionCmd->SetRange("fraction > 0. && fraction <= 1.");
+  m_pIsotropicFractionCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pParticlesCmd = new G4UIcmdWithAString("/xe/gun/bias/particles", this);
+  m_pParticlesCmd->SetGuidance("Space separated list of biased particles.");
+  m_pParticlesCmd->SetParameterName("particles", false);
+  m_pParticlesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/xe/gun/bias/print", this);
+  m_pPrintCmd->SetGuidance("Print the biasing settings.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tAngularBiasingMessenger::~Xenon1tAngularBiasingMessenger() {
+  delete m_pActiveCmd;
+  delete m_pTargetCmd;
+  delete m_pTargetVolumeCmd;
+  delete m_pIsotropicFractionCmd;
+  delete m_pParticlesCmd;
+  delete m_pPrintCmd;
+  delete m_pBiasDir;
+}
+
+void Xenon1tAngularBiasingMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                 G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pBiasing->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pTargetCmd) {
+    G4double dX, dY, dZ, dRadius;
+    G4String hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> dX >> dY >> dZ >> dRadius >> hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pBiasing->SetTarget(G4ThreeVector(dX, dY, dZ) * dUnit, dRadius * dUnit);
+  }
+
+  if (pUIcommand == m_pTargetVolumeCmd) m_pBiasing->SetTargetVolume(hNewValue);
+
+  if (pUIcommand == m_pIsotropicFractionCmd)
+    m_pBiasing->SetIsotropicFraction(
+        m_pIsotropicFractionCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pParticlesCmd) m_pBiasing->SetParticles(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) m_pBiasing->PrintBiasing();
+}
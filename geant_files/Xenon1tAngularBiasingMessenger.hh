@@ -0,0 +1,34 @@
+#ifndef __XENON1TANGULARBIASINGMESSENGER_H__
+#define __XENON1TANGULARBIASINGMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tAngularBiasing;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tAngularBiasingMessenger : public G4UImessenger {
+ public:
+  Xenon1tAngularBiasingMessenger(Xenon1tAngularBiasing *pBiasing);
+  ~Xenon1tAngularBiasingMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tAngularBiasing *m_pBiasing;
+
+  G4UIdirectory *m_pBiasDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pTargetCmd;
+  G4UIcmdWithAString *m_pTargetVolumeCmd;
+  G4UIcmdWithADouble *m_pIsotropicFractionCmd;
+  G4UIcmdWithAString *m_pParticlesCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
@@ -0,0 +1,151 @@
+// XENON Header Files
+#include "Xenon1tCheckpoint.hh"
+#include "Xenon1tCheckpointMessenger.hh"
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tEventTime.hh"
+#include "Xenon1tForkRunner.hh"
+#include "Xenon1tPhaseSpaceRecorder.hh"
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tThreadOutput.hh"
+
+// Additional Header Files
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+using std::ifstream;
+using std::ofstream;
+
+// G4 Header Files
+#include <G4RunManager.hh>
+#include <Randomize.hh>
+
+G4ThreadLocal Xenon1tCheckpoint *Xenon1tCheckpoint::m_pInstance = 0;
+
+Xenon1tCheckpoint *Xenon1tCheckpoint::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tCheckpoint();
+  return m_pInstance;
+}
+
+Xenon1tCheckpoint::Xenon1tCheckpoint() {
+  m_bActive = false;
+  m_iInterval = 1000;
+  m_bResume = false;
+  m_iCompletedEvents = 0;
+  m_iLastCheckpoint = 0;
+  m_iResumedEvents = 0;
+
+  // array tasks get a checkpoint next to their output from job.sh
+  const char *szFileName = std::getenv("XE_CHECKPOINT");
+  m_hFileName = szFileName ? szFileName : "checkpoint.txt";
+
+  m_pMessenger = new Xenon1tCheckpointMessenger(this);
+}
+
+Xenon1tCheckpoint::~Xenon1tCheckpoint() { delete m_pMessenger; }
+
+G4String Xenon1tCheckpoint::GetFileName() const {
+  // one file per worker thread or forked worker
+  return Xenon1tThreadOutput::GetFileName(m_hFileName);
+}
+
+G4int Xenon1tCheckpoint::Resume(G4int iEvents) {
+  if (!m_bActive || !m_bResume) return iEvents;
+
+  const G4String hFileName = GetFileName();
+  ifstream hFile(hFileName.c_str());
+  if (!hFile.is_open()) {
+    G4cout << "Xenon1tCheckpoint: no " << hFileName << ", starting from "
+           << "scratch" << G4endl;
+    return iEvents;
+  }
+
+  if (G4RunManager::GetRunManager()->GetRunManagerType() !=
+          G4RunManager::sequentialRM ||
+      Xenon1tForkRunner::GetInstance()->GetNumberOfWorkers() > 1) {
+    G4Exception("Xenon1tCheckpoint::Resume()", "Checkpoint", JustWarning,
+                "Resuming needs a sequential run, starting from scratch");
+    return iEvents;
+  }
+
+  G4int iCompleted = 0, iRecords = 0;
+  unsigned int iQuasiRandomIndex = 0;
+  long iPhaseSpaceSize = 0;
+  G4double dEventTime = 0.;
+  G4String hKey;
+  while (hFile >> hKey && hKey != "rng") {
+    if (hKey == "completed") hFile >> iCompleted;
+    else if (hKey == "event_time") hFile >> dEventTime;
+    else if (hKey == "qmc_index") hFile >> iQuasiRandomIndex;
+    else if (hKey == "phase_space") hFile >> iPhaseSpaceSize >> iRecords;
+    else hFile.ignore(1024, '\n');
+  }
+
+  Xenon1tEventRandom *pEventRandom = Xenon1tEventRandom::GetInstance();
+  if (pEventRandom->IsActive())
+    pEventRandom->SetFirstEvent(pEventRandom->GetFirstEvent() + iCompleted);
+  else if (hKey == "rng")
+    G4Random::getTheEngine()->get(hFile);
+  if (hFile.bad() || hKey != "rng")
+    G4Exception("Xenon1tCheckpoint::Resume()", "Checkpoint", FatalException,
+                ("Corrupt checkpoint " + hFileName).c_str());
+
+  Xenon1tEventTime::GetInstance()->SetStartTime(dEventTime);
+  Xenon1tQuasiRandom::GetInstance()->SetIndex(iQuasiRandomIndex);
+  Xenon1tPhaseSpaceRecorder::GetInstance()->Resume(iPhaseSpaceSize, iRecords,
+                                                   iCompleted);
+
+  m_iCompletedEvents = iCompleted;
+  m_iLastCheckpoint = iCompleted;
+  m_iResumedEvents = iCompleted;
+
+  const G4int iRemaining = (iEvents > iCompleted) ? iEvents - iCompleted : 0;
+  G4cout << "Xenon1tCheckpoint: resuming from " << hFileName << " after "
+         << iCompleted << " events, " << iRemaining << " left" << G4endl;
+  return iRemaining;
+}
+
+G4bool Xenon1tCheckpoint::EndOfEvent() {
+  if (!m_bActive) return false;
+  m_iCompletedEvents++;
+  return m_iCompletedEvents - m_iLastCheckpoint >= m_iInterval;
+}
+
+void Xenon1tCheckpoint::Write() {
+  if (!m_bActive) return;
+
+  Xenon1tPhaseSpaceRecorder *pRecorder =
+      Xenon1tPhaseSpaceRecorder::GetInstance();
+  const long iPhaseSpaceSize = pRecorder->Flush();
+
+  const G4String hFileName = GetFileName();
+  const G4String hTemporary = hFileName + ".tmp";
+  ofstream hFile(hTemporary.c_str());
+  if (!hFile.is_open()) {
+    G4Exception("Xenon1tCheckpoint::Write()", "Checkpoint", JustWarning,
+                ("Cannot write " + hTemporary).c_str());
+    return;
+  }
+
+  hFile << std::setprecision(17);
+  hFile << "completed " << m_iCompletedEvents << "\n";
+  hFile << "first_event " << Xenon1tEventRandom::GetInstance()->GetFirstEvent()
+        << "\n";
+  hFile << "event_time " << Xenon1tEventTime::GetInstance()->GetTime()
+        << "\n";
+  hFile << "qmc_index " << Xenon1tQuasiRandom::GetInstance()->GetIndex()
+        << "\n";
+  hFile << "phase_space " << iPhaseSpaceSize << " "
+        << pRecorder->GetNumberOfRecords() << "\n";
+  hFile << "rng\n";
+  G4Random::getTheEngine()->put(hFile);
+  hFile.close();
+
+  if (hFile.fail() || std::rename(hTemporary.c_str(), hFileName.c_str())) {
+    G4Exception("Xenon1tCheckpoint::Write()", "Checkpoint", JustWarning,
+                ("Cannot write " + hFileName).c_str());
+    return;
+  }
+  m_iLastCheckpoint = m_iCompletedEvents;
+}
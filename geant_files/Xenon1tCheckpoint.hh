@@ -0,0 +1,66 @@
+#ifndef __XENON1TCHECKPOINT_H__
+#define __XENON1TCHECKPOINT_H__
+
+#include <globals.hh>
+
+class Xenon1tCheckpointMessenger;
+
+// Checkpoints of long jobs: every /Xe/checkpoint/interval events the output
+// is flushed and a small file records the number of completed events and
+// the state needed to continue exactly there (random engine, event-time
+// clock, QMC index, phase-space file size). The file is written to a
+// temporary name and renamed, so that it always describes a complete state.
+// A job restarted with /Xe/checkpoint/resume simulates only the events that
+// were not completed and appends to the same output; a job that crashed
+// after its last event (e.g. in TFile::Close at ROOT teardown) has nothing
+// left to do.
+//
+// With the counter-based streams (Xenon1tEventRandom) the resumed events
+// are exactly those of an uninterrupted run; otherwise the engine state of
+// the checkpoint is restored.
+//
+// Hook-ups: main calls Resume(n) before BeamOn and runs the number of
+// events it returns; the analysis manager opens its file in UPDATE mode
+// when IsResuming(), calls EndOfEvent() at the end of every event and,
+// when it returns true, AutoSave()s its tree and calls Write(); the run
+// action calls Write() at the end of the run. Resuming is for sequential
+// runs (threads and forked workers write their own checkpoint files).
+
+class Xenon1tCheckpoint {
+ public:
+  static Xenon1tCheckpoint *GetInstance();
+  ~Xenon1tCheckpoint();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetFileName(const G4String &hFileName) { m_hFileName = hFileName; }
+  void SetInterval(G4int iInterval) { m_iInterval = iInterval; }
+  void SetResume(G4bool bResume) { m_bResume = bResume; }
+
+  G4int Resume(G4int iEvents);
+  G4bool IsResuming() const { return m_iResumedEvents > 0; }
+  G4int GetResumedEvents() const { return m_iResumedEvents; }
+
+  G4bool EndOfEvent();
+  void Write();
+
+ private:
+  Xenon1tCheckpoint();
+
+  G4String GetFileName() const;
+
+  static G4ThreadLocal Xenon1tCheckpoint *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hFileName;
+  G4int m_iInterval;
+  G4bool m_bResume;
+
+  G4int m_iCompletedEvents;
+  G4int m_iLastCheckpoint;
+  G4int m_iResumedEvents;
+
+  Xenon1tCheckpointMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,62 @@
+// XENON Header Files
+#include "Xenon1tCheckpointMessenger.hh"
+#include "Xenon1tCheckpoint.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tCheckpointMessenger::Xenon1tCheckpointMessenger(
+    Xenon1tCheckpoint *pCheckpoint)
+    : m_pCheckpoint(pCheckpoint) {
+  m_pCheckpointDir = new G4UIdirectory("/Xe/checkpoint/");
+  m_pCheckpointDir->SetGuidance("Checkpoints and resume of long jobs.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/checkpoint/setActive", this);
+  m_pActiveCmd->SetGuidance("Write checkpoints during the run.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pFileCmd = new G4UIcmdWithAString("/Xe/checkpoint/file", this);
+  m_pFileCmd->SetGuidance("Checkpoint file (default: $XE_CHECKPOINT or "
+                          "checkpoint.txt).");
+  m_pFileCmd->SetParameterName("file", false);
+  m_pFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pIntervalCmd = new G4UIcmdWithAnInteger("/Xe/checkpoint/interval", this);
+  m_pIntervalCmd->SetGuidance("Events between two checkpoints.");
+  m_pIntervalCmd->SetParameterName("events", false);
+  m_pIntervalCmd->SetRange("events >= 1");
+  m_pIntervalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pResumeCmd = new G4UIcmdWithABool("/Xe/checkpoint/resume", this);
+  m_pResumeCmd->SetGuidance("Continue from the checkpoint file if there is "
+                            "one.");
+  m_pResumeCmd->SetParameterName("resume", false);
+  m_pResumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tCheckpointMessenger::~Xenon1tCheckpointMessenger() {
+  delete m_pActiveCmd;
+  delete m_pFileCmd;
+  delete m_pIntervalCmd;
+  delete m_pResumeCmd;
+  delete m_pCheckpointDir;
+}
+
+void Xenon1tCheckpointMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                             G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pCheckpoint->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pFileCmd) m_pCheckpoint->SetFileName(hNewValue);
+
+  if (pUIcommand == m_pIntervalCmd)
+    m_pCheckpoint->SetInterval(m_pIntervalCmd->GetNewIntValue(hNewValue));
+
+  if (pUIcommand == m_pResumeCmd)
+    m_pCheckpoint->SetResume(m_pResumeCmd->GetNewBoolValue(hNewValue));
+}
@@ -0,0 +1,31 @@
+#ifndef __XENON1TCHECKPOINTMESSENGER_H__
+#define __XENON1TCHECKPOINTMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tCheckpoint;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+
+class Xenon1tCheckpointMessenger : public G4UImessenger {
+ public:
+  Xenon1tCheckpointMessenger(Xenon1tCheckpoint *pCheckpoint);
+  ~Xenon1tCheckpointMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tCheckpoint *m_pCheckpoint;
+
+  G4UIdirectory *m_pCheckpointDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pFileCmd;
+  G4UIcmdWithAnInteger *m_pIntervalCmd;
+  G4UIcmdWithABool *m_pResumeCmd;
+};
+
+#endif
@@ -0,0 +1,247 @@
+// XENON Header Files
+#include "Xenon1tAngularBiasing.hh"
+#include "Xenon1tDecayGenerator.hh"
+#include "Xenon1tDecayGeneratorMessenger.hh"
+#include "Xenon1tDecayTable.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tEventTime.hh"
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tSurfaceSource.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+
+// G4 Header Files
+#include <G4Alpha.hh>
+#include <G4Electron.hh>
+#include <G4Event.hh>
+#include <G4Gamma.hh>
+#include <G4Positron.hh>
+#include <G4PrimaryParticle.hh>
+#include <G4PrimaryVertex.hh>
+#include <G4RandomDirection.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tDecayGenerator::Xenon1tDecayGenerator(G4bool bWithMessenger) {
+  m_pTable = 0;
+  m_hTableDirectory = "decay_tables";
+  m_iLastRecord = -1;
+  m_iLastNuclide = -1;
+  m_dLastWeight = 1.;
+  m_bUniformSampling = false;
+  m_bSamplingReady = false;
+  m_dDecaysPerParentDecay = 1.;
+
+  m_pGamma = G4Gamma::Definition();
+  m_pElectron = G4Electron::Definition();
+  m_pPositron = G4Positron::Definition();
+  m_pAlpha = G4Alpha::Definition();
+
+  m_pMessenger =
+      bWithMessenger ? new Xenon1tDecayGeneratorMessenger(this) : 0;
+}
+
+Xenon1tDecayGenerator::~Xenon1tDecayGenerator() { delete m_pMessenger; }
+
+void Xenon1tDecayGenerator::SetSegment(const G4String &hSegment) {
+  if (hSegment == "None") {
+    m_pTable = 0;
+    return;
+  }
+  m_pTable =
+      Xenon1tDecayTable::GetTable(m_hTableDirectory + "/" + hSegment + ".dat");
+  m_bSamplingReady = false;
+}
+
+void Xenon1tDecayGenerator::SetActivity(const G4String &hNuclide,
+                                        G4double dActivity) {
+  // activity relative to the chain parent, checked against the table when
+  // the sampling is built
+  if (dActivity < 0.)
+    G4Exception("Xenon1tDecayGenerator::SetActivity()", "DecayGenerator",
+                FatalException, "Negative activity");
+  m_hActivities[hNuclide] = dActivity;
+  m_bSamplingReady = false;
+}
+
+void Xenon1tDecayGenerator::SetSampling(const G4String &hSampling) {
+  m_bUniformSampling = (hSampling == "uniform");
+  m_bSamplingReady = false;
+}
+
+void Xenon1tDecayGenerator::BuildNuclideSampling() {
+  const G4int iNuclides = m_pTable->GetNumberOfNuclides();
+
+  for (map<G4String, G4double>::iterator pIt = m_hActivities.begin();
+       pIt != m_hActivities.end(); ++pIt)
+    if (m_pTable->GetNuclideIndex(pIt->first) < 0)
+      G4Exception("Xenon1tDecayGenerator::BuildNuclideSampling()",
+                  "DecayGenerator", FatalException,
+                  ("Nuclide " + pIt->first + " is not in " +
+                   m_pTable->GetFileName()).c_str());
+
+  vector<G4double> hActivities(iNuclides);
+  G4double dTotalActivity = 0.;
+  G4int iActive = 0;
+  for (G4int i = 0; i < iNuclides; i++) {
+    map<G4String, G4double>::iterator pIt =
+        m_hActivities.find(m_pTable->GetNuclideName(i));
+    hActivities[i] = (pIt != m_hActivities.end())
+                         ? pIt->second
+                         : m_pTable->GetEquilibriumActivity(i);
+    dTotalActivity += hActivities[i];
+    if (hActivities[i] > 0.) iActive++;
+  }
+  if (dTotalActivity <= 0.)
+    G4Exception("Xenon1tDecayGenerator::BuildNuclideSampling()",
+                "DecayGenerator", FatalException, "No active nuclide");
+
+  // weights are normalised to the activity of the chain parent, which stays
+  // the reference also when its own activity is set to zero
+  map<G4String, G4double>::iterator pParent =
+      m_hActivities.find(m_pTable->GetNuclideName(0));
+  G4double dParentActivity = (pParent != m_hActivities.end())
+                                 ? pParent->second
+                                 : m_pTable->GetEquilibriumActivity(0);
+  if (dParentActivity <= 0.) dParentActivity = 1.;
+
+  m_hNuclideCumulative.assign(iNuclides, 0.);
+  m_hNuclideWeights.assign(iNuclides, 0.);
+  G4double dCumulative = 0.;
+  for (G4int i = 0; i < iNuclides; i++) {
+    if (hActivities[i] > 0.) {
+      const G4double dProbability = m_bUniformSampling
+                                        ? 1. / iActive
+                                        : hActivities[i] / dTotalActivity;
+      dCumulative += dProbability;
+      m_hNuclideWeights[i] = hActivities[i] / dParentActivity / dProbability;
+    }
+    m_hNuclideCumulative[i] = dCumulative;
+  }
+
+  m_dDecaysPerParentDecay = dTotalActivity / dParentActivity;
+  m_bSamplingReady = true;
+  PrintChain();
+}
+
+G4double Xenon1tDecayGenerator::GetDecaysPerParentDecay() {
+  if (!m_bSamplingReady) BuildNuclideSampling();
+  return m_dDecaysPerParentDecay;
+}
+
+void Xenon1tDecayGenerator::PrintChain() {
+  if (!m_pTable) return;
+  if (!m_bSamplingReady) BuildNuclideSampling();
+
+  G4cout << "Xenon1tDecayGenerator: " << m_pTable->GetFileName() << " ("
+         << (m_bUniformSampling ? "uniform" : "activity") << " sampling)"
+         << G4endl;
+  G4double dPrevious = 0.;
+  for (G4int i = 0; i < m_pTable->GetNumberOfNuclides(); i++) {
+    G4cout << "  " << m_pTable->GetNuclideName(i);
+    if (m_pTable->GetNumberOfSegments() > 1)
+      G4cout << " ("
+             << m_pTable->GetSegmentName(m_pTable->GetNuclideSegment(i))
+             << ")";
+    G4cout << ": probability = " << m_hNuclideCumulative[i] - dPrevious
+           << ", weight = " << m_hNuclideWeights[i] << G4endl;
+    dPrevious = m_hNuclideCumulative[i];
+  }
+}
+
+void Xenon1tDecayGenerator::GeneratePrimaryVertex(G4Event *pEvent) {
+  if (!m_pTable) {
+    G4Exception("Xenon1tDecayGenerator::GeneratePrimaryVertex()",
+                "DecayGenerator", FatalException,
+                "No decay table selected, use /xe/gun/decay/segment");
+    return;
+  }
+
+  if (!m_bSamplingReady) BuildNuclideSampling();
+
+  Xenon1tEventRandom::GetInstance()->BeginEvent(pEvent);
+  Xenon1tQuasiRandom *pQuasiRandom = Xenon1tQuasiRandom::GetInstance();
+  pQuasiRandom->BeginEvent(pEvent);
+  Xenon1tEventTime::GetInstance()->BeginEvent(pEvent);
+
+  // plate-out runs take the vertex from the surface source
+  Xenon1tSurfaceSource *pSurfaceSource = Xenon1tSurfaceSource::GetInstance();
+  if (pSurfaceSource->IsActive())
+    particle_position = pSurfaceSource->SamplePosition();
+
+  const G4double dRandom = G4UniformRand() * m_hNuclideCumulative.back();
+  m_iLastNuclide = (G4int)(std::upper_bound(m_hNuclideCumulative.begin(),
+                                            m_hNuclideCumulative.end(),
+                                            dRandom) -
+                           m_hNuclideCumulative.begin());
+  if (m_iLastNuclide >= m_pTable->GetNumberOfNuclides())
+    m_iLastNuclide = m_pTable->GetNumberOfNuclides() - 1;
+  m_dLastWeight = m_hNuclideWeights[m_iLastNuclide];
+  m_iLastRecord = m_pTable->SampleRecord(m_iLastNuclide);
+
+  G4PrimaryVertex *pVertex =
+      new G4PrimaryVertex(particle_position, particle_time);
+  Xenon1tAngularBiasing *pBiasing = Xenon1tAngularBiasing::GetInstance();
+
+  const Xenon1tDecayTable::Emission *pEmission, *pLast;
+  m_pTable->GetEmissions(m_iLastRecord, pEmission, pLast);
+
+  const Xenon1tDecayTable::Emission *pFirst = pEmission;
+  for (; pEmission != pLast; ++pEmission) {
+    G4ParticleDefinition *pDefinition = 0;
+    G4double dEnergy = pEmission->dEnergy;
+
+    switch (pEmission->iType) {
+      case Xenon1tDecayTable::eGamma:
+      case Xenon1tDecayTable::eXray:
+        pDefinition = m_pGamma;
+        break;
+      case Xenon1tDecayTable::eElectron:
+        pDefinition = m_pElectron;
+        break;
+      case Xenon1tDecayTable::eAlpha:
+        pDefinition = m_pAlpha;
+        break;
+      case Xenon1tDecayTable::eBeta:
+        pDefinition = m_pElectron;
+        dEnergy = m_pTable->SampleBetaEnergy(pEmission->iSpectrum);
+        break;
+      case Xenon1tDecayTable::ePositron:
+        pDefinition = m_pPositron;
+        dEnergy = m_pTable->SampleBetaEnergy(pEmission->iSpectrum);
+        break;
+    }
+
+    // emissions of one decay are isotropic and uncorrelated in direction,
+    // as in G4RadioactiveDecay, so the direction weights of a cascade multiply
+    G4ThreeVector hDirection;
+    if (pBiasing->IsBiased(pDefinition))
+      m_dLastWeight *=
+          pBiasing->SampleDirection(particle_position, hDirection);
+    else if (pQuasiRandom->IsActive() && pEmission == pFirst)
+      hDirection = pQuasiRandom->GetIsotropicDirection();
+    else
+      hDirection = G4RandomDirection();
+
+    const G4double dMass = pDefinition->GetPDGMass();
+    const G4double dMomentum = std::sqrt(dEnergy * (dEnergy + 2. * dMass));
+    G4PrimaryParticle *pParticle = new G4PrimaryParticle(pDefinition);
+    pParticle->SetMomentum(hDirection * dMomentum);
+    pVertex->SetPrimary(pParticle);
+  }
+
+  // the source weights go on the event only: the vertex, hence the primary
+  // tracks, keep weight 1 so that the track weights are those of the
+  // transport biasing and the hit weight is event weight * track weight
+  Xenon1tEventInformation *pInformation =
+      Xenon1tEventInformation::GetOrCreate(pEvent);
+  pInformation->SetNuclide(m_pTable->GetNuclideName(m_iLastNuclide));
+  pInformation->MultiplyWeight(m_dLastWeight);
+
+  pEvent->AddPrimaryVertex(pVertex);
+}
@@ -0,0 +1,83 @@
+#ifndef __XENON1TDECAYGENERATOR_H__
+#define __XENON1TDECAYGENERATOR_H__
+
+#include <G4VPrimaryGenerator.hh>
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+class Xenon1tDecayTable;
+class Xenon1tDecayGeneratorMessenger;
+class G4Event;
+class G4ParticleDefinition;
+
+// Emits the products of one tabulated decay per event, instead of shooting an
+// ion and letting G4RadioactiveDecay walk the chain. The vertex position and
+// time are set by the caller (SetParticlePosition/SetParticleTime), so the
+// usual volume confinement of the particle source still applies.
+//
+// Multi-nuclide tables run in chain mode: each event first picks the nuclide
+// that decays, either in proportion to its activity ("activity" sampling) or
+// with equal probability ("uniform"), and carries the weight
+//
+//   w = (A_nuclide / A_parent) / p_nuclide
+//
+// so that the weighted event count divided by the number of generated events
+// is the number of decays per decay of the chain parent. Activities default
+// to secular equilibrium and can be broken per nuclide from the macro.
+
+class Xenon1tDecayGenerator : public G4VPrimaryGenerator {
+ public:
+  // generators owned by another source leave the /xe/gun/decay/ commands
+  // to the main one
+  Xenon1tDecayGenerator(G4bool bWithMessenger = true);
+  ~Xenon1tDecayGenerator();
+
+  void GeneratePrimaryVertex(G4Event *pEvent);
+
+  void SetTableDirectory(const G4String &hDirectory) {
+    m_hTableDirectory = hDirectory;
+  }
+  void SetSegment(const G4String &hSegment);
+  void SetActivity(const G4String &hNuclide, G4double dActivity);
+  void SetSampling(const G4String &hSampling);
+
+  G4bool IsActive() const { return m_pTable != 0; }
+  const Xenon1tDecayTable *GetTable() const { return m_pTable; }
+  G4int GetLastRecord() const { return m_iLastRecord; }
+  G4int GetLastNuclide() const { return m_iLastNuclide; }
+  G4double GetLastWeight() const { return m_dLastWeight; }
+  // sum of the member activities over the parent activity
+  G4double GetDecaysPerParentDecay();
+
+  void PrintChain();
+
+ private:
+  void BuildNuclideSampling();
+
+  Xenon1tDecayTable *m_pTable;
+  G4String m_hTableDirectory;
+  G4int m_iLastRecord;
+  G4int m_iLastNuclide;
+  G4double m_dLastWeight;
+
+  map<G4String, G4double> m_hActivities;
+  G4bool m_bUniformSampling;
+  G4bool m_bSamplingReady;
+  G4double m_dDecaysPerParentDecay;
+  vector<G4double> m_hNuclideCumulative;
+  vector<G4double> m_hNuclideWeights;
+
+  G4ParticleDefinition *m_pGamma;
+  G4ParticleDefinition *m_pElectron;
+  G4ParticleDefinition *m_pPositron;
+  G4ParticleDefinition *m_pAlpha;
+
+  Xenon1tDecayGeneratorMessenger *m_pMessenger;
+};
+
+#endif
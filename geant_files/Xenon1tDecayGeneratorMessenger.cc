@@ -0,0 +1,91 @@
+// XENON Header Files
+#include "Xenon1tDecayGeneratorMessenger.hh"
+#include "Xenon1tDecayGenerator.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tDecayGeneratorMessenger::Xenon1tDecayGeneratorMessenger(
+    Xenon1tDecayGenerator *pGenerator)
+    : m_pGenerator(pGenerator) {
+  m_pDecayDir = new G4UIdirectory("/xe/gun/decay/");
+  m_pDecayDir->SetGuidance("Pre-tabulated decay product generator.");
+
+  m_pDirectoryCmd = new G4UIcmdWithAString("/xe/gun/decay/directory", this);
+  m_pDirectoryCmd->SetGuidance("Directory holding the <segment>.dat tables.");
+  m_pDirectoryCmd->SetParameterName("directory", false);
+  m_pDirectoryCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pSegmentCmd = new G4UIcmdWithAString("/xe/gun/decay/segment", this);
+  m_pSegmentCmd->SetGuidance("Chain segment or whole chain to generate, "
+                             "e.g. Co60, Ra226 or U238Chain.");
+  m_pSegmentCmd->SetGuidance("Replaces /xe/gun/ion.");
+  m_pSegmentCmd->SetGuidance("None goes back to the ion source.");
+  m_pSegmentCmd->SetParameterName("segment", false);
+  m_pSegmentCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pActivityCmd = new G4UIcommand("/xe/gun/decay/activity", this);
+  m_pActivityCmd->SetGuidance("Activity of a chain member relative to the "
+                              "chain parent (broken equilibrium).");
+  m_pActivityCmd->SetGuidance("Defaults to secular equilibrium.");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("nuclide", 's', false);
+  m_pActivityCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("activity", 'd', false);
+  pParameter->SetParameterRange("activity >= 0.");
+  m_pActivityCmd->SetParameter(pParameter);
+  m_pActivityCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pSamplingCmd = new G4UIcmdWithAString("/xe/gun/decay/sampling", this);
+  m_pSamplingCmd->SetGuidance("How the decaying chain member is picked:");
+  m_pSamplingCmd->SetGuidance("  activity - in proportion to its activity");
+  m_pSamplingCmd->SetGuidance("  uniform  - equal statistics per member, "
+                              "compensated by the event weight");
+  m_pSamplingCmd->SetParameterName("sampling", false);
+  m_pSamplingCmd->SetCandidates("activity uniform");
+  m_pSamplingCmd->SetDefaultValue("activity");
+  m_pSamplingCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/xe/gun/decay/print", this);
+  m_pPrintCmd->SetGuidance("Print sampling probability and weight per "
+                           "chain member.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tDecayGeneratorMessenger::~Xenon1tDecayGeneratorMessenger() {
+  delete m_pDirectoryCmd;
+  delete m_pSegmentCmd;
+  delete m_pActivityCmd;
+  delete m_pSamplingCmd;
+  delete m_pPrintCmd;
+  delete m_pDecayDir;
+}
+
+void Xenon1tDecayGeneratorMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                 G4String hNewValue) {
+  if (pUIcommand == m_pDirectoryCmd)
+    m_pGenerator->SetTableDirectory(hNewValue);
+
+  if (pUIcommand == m_pSegmentCmd) m_pGenerator->SetSegment(hNewValue);
+
+  if (pUIcommand == m_pActivityCmd) {
+    G4String hNuclide;
+    G4double dActivity = 0.;
+    istringstream hStream(hNewValue);
+    hStream >> hNuclide >> dActivity;
+    m_pGenerator->SetActivity(hNuclide, dActivity);
+  }
+
+  if (pUIcommand == m_pSamplingCmd) m_pGenerator->SetSampling(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) m_pGenerator->PrintChain();
+}
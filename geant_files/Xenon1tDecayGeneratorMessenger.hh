@@ -0,0 +1,31 @@
+#ifndef __XENON1TDECAYGENERATORMESSENGER_H__
+#define __XENON1TDECAYGENERATORMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tDecayGenerator;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tDecayGeneratorMessenger : public G4UImessenger {
+ public:
+  Xenon1tDecayGeneratorMessenger(Xenon1tDecayGenerator *pGenerator);
+  ~Xenon1tDecayGeneratorMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tDecayGenerator *m_pGenerator;
+
+  G4UIdirectory *m_pDecayDir;
+  G4UIcmdWithAString *m_pDirectoryCmd;
+  G4UIcmdWithAString *m_pSegmentCmd;
+  G4UIcommand *m_pActivityCmd;
+  G4UIcmdWithAString *m_pSamplingCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
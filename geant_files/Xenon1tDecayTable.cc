@@ -0,0 +1,289 @@
+// XENON Header Files
+#include "Xenon1tDecayTable.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+using std::ifstream;
+using std::istringstream;
+
+// G4 Header Files
+#include <G4AutoLock.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4PhysicalConstants.hh>
+#include <G4SystemOfUnits.hh>
+#endif
+
+map<G4String, Xenon1tDecayTable *> Xenon1tDecayTable::m_hTables;
+
+namespace {
+G4Mutex hTablesMutex = G4MUTEX_INITIALIZER;
+}
+
+Xenon1tDecayTable *Xenon1tDecayTable::GetTable(const G4String &hFileName) {
+  // every chain segment is read and tabulated only once per job; the tables
+  // are read-only once built and are shared by the worker threads
+  G4AutoLock hLock(&hTablesMutex);
+  map<G4String, Xenon1tDecayTable *>::iterator pIt = m_hTables.find(hFileName);
+  if (pIt != m_hTables.end()) return pIt->second;
+
+  Xenon1tDecayTable *pTable = new Xenon1tDecayTable(hFileName);
+  m_hTables[hFileName] = pTable;
+  return pTable;
+}
+
+Xenon1tDecayTable::Xenon1tDecayTable(const G4String &hFileName)
+    : m_hFileName(hFileName) {
+  ReadTable();
+}
+
+Xenon1tDecayTable::~Xenon1tDecayTable() { ; }
+
+void Xenon1tDecayTable::ReadTable() {
+  ReadFile(m_hFileName, 1., 0);
+  m_hRecordOffsets.push_back((G4int)m_hEmissions.size());
+  m_hNuclideOffsets.push_back((G4int)m_hCumulative.size());
+
+  G4int iRecords = 0;
+  for (size_t i = 0; i < m_hNuclides.size(); i++) {
+    if (m_hNuclideOffsets[i] == m_hNuclideOffsets[i + 1])
+      G4Exception("Xenon1tDecayTable::ReadTable()", "DecayTable",
+                  FatalException,
+                  ("No decay records for " + m_hNuclides[i] + " in " +
+                   m_hFileName).c_str());
+    iRecords += m_hNuclideOffsets[i + 1] - m_hNuclideOffsets[i];
+  }
+  if (m_hNuclides.empty())
+    G4Exception("Xenon1tDecayTable::ReadTable()", "DecayTable", FatalException,
+                ("No nuclides in " + m_hFileName).c_str());
+
+  G4cout << "Xenon1tDecayTable: " << m_hFileName << " - "
+         << m_hSegments.size() << " segments, " << m_hNuclides.size()
+         << " nuclides, " << iRecords << " decay records, "
+         << m_hEmissions.size() << " emissions, " << m_hSpectra.size()
+         << " beta spectra" << G4endl;
+}
+
+void Xenon1tDecayTable::ReadFile(const G4String &hFileName,
+                                 G4double dActivity, G4int iDepth) {
+  ifstream hFile(hFileName.c_str());
+  if (!hFile.is_open())
+    G4Exception("Xenon1tDecayTable::ReadFile()", "DecayTable", FatalException,
+                ("Cannot open decay table " + hFileName).c_str());
+
+  // a table without segment lines is a segment of its own
+  G4bool bSegment = false;
+  std::string hLine;
+  G4int iLine = 0;
+  G4double dTotal = 0.;
+
+  while (std::getline(hFile, hLine)) {
+    iLine++;
+    const size_t iComment = hLine.find('#');
+    if (iComment != std::string::npos) hLine.erase(iComment);
+
+    istringstream hStream(hLine);
+    G4String hKey;
+    if (!(hStream >> hKey)) continue;
+
+    if (hKey == "segment") {
+      // segments are read from the directory of the chain table, with the
+      // activity of their first nuclide relative to the chain parent
+      G4String hName;
+      G4double dSegmentActivity = 1.;
+      hStream >> hName >> dSegmentActivity;
+      if (iDepth > 0 || !m_hNuclides.empty())
+        G4Exception("Xenon1tDecayTable::ReadFile()", "DecayTable",
+                    FatalException,
+                    ("Segment " + hName + " in " + hFileName +
+                     ": segments go in chain tables, before any nuclide")
+                        .c_str());
+      const size_t iSlash = hFileName.rfind('/');
+      const G4String hDirectory = (iSlash == std::string::npos)
+                                      ? G4String(".")
+                                      : G4String(hFileName.substr(0, iSlash));
+      m_hSegments.push_back(hName);
+      m_hSegmentOffsets.push_back((G4int)m_hNuclides.size());
+      ReadFile(hDirectory + "/" + hName + ".dat", dSegmentActivity, 1);
+      bSegment = true;
+      continue;
+    }
+
+    if (bSegment) {
+      G4cerr << "Xenon1tDecayTable: " << hFileName << ":" << iLine
+             << " only segment lines in a chain table" << G4endl;
+      continue;
+    }
+
+    if (hKey == "nuclide") {
+      G4String hName;
+      G4double dNuclideActivity = 1.;
+      hStream >> hName >> dNuclideActivity;
+      if (iDepth == 0 && m_hNuclides.empty()) {
+        m_hSegments.push_back(hName);
+        m_hSegmentOffsets.push_back(0);
+      }
+      m_hNuclides.push_back(hName);
+      m_hEquilibriumActivity.push_back(dActivity * dNuclideActivity);
+      m_hNuclideOffsets.push_back((G4int)m_hCumulative.size());
+      dTotal = 0.;
+      continue;
+    }
+
+    if (hKey == "decay") {
+      G4double dIntensity = 0.;
+      hStream >> dIntensity;
+      if (m_hNuclides.empty() || dIntensity <= 0.) {
+        G4cerr << "Xenon1tDecayTable: " << hFileName << ":" << iLine
+               << " decay without nuclide or intensity" << G4endl;
+        continue;
+      }
+      // cumulative intensities restart for every nuclide
+      dTotal += dIntensity;
+      m_hRecordNuclide.push_back((G4int)m_hNuclides.size() - 1);
+      m_hCumulative.push_back(dTotal);
+      m_hRecordOffsets.push_back((G4int)m_hEmissions.size());
+      continue;
+    }
+
+    if (m_hRecordOffsets.empty()) {
+      G4cerr << "Xenon1tDecayTable: " << hFileName << ":" << iLine
+             << " emission outside of a decay record" << G4endl;
+      continue;
+    }
+
+    Emission hEmission;
+    hEmission.iSpectrum = -1;
+    if (!(hStream >> hEmission.dEnergy)) continue;
+    hEmission.dEnergy *= keV;
+
+    if (hKey == "gamma")
+      hEmission.iType = eGamma;
+    else if (hKey == "xray")
+      hEmission.iType = eXray;
+    else if (hKey == "electron")
+      hEmission.iType = eElectron;
+    else if (hKey == "alpha")
+      hEmission.iType = eAlpha;
+    else if (hKey == "beta" || hKey == "positron") {
+      G4int iZ = 0;
+      G4String hShape;
+      hStream >> iZ >> hShape;
+      hEmission.iType = (hKey == "beta") ? eBeta : ePositron;
+      hEmission.iSpectrum = AddBetaSpectrum(hEmission.dEnergy, iZ,
+                                            hShape == "1u",
+                                            hEmission.iType == ePositron);
+    } else {
+      G4cerr << "Xenon1tDecayTable: " << hFileName << ":" << iLine
+             << " unknown emission " << hKey << G4endl;
+      continue;
+    }
+
+    m_hEmissions.push_back(hEmission);
+  }
+}
+
+G4int Xenon1tDecayTable::GetNuclideIndex(const G4String &hName) const {
+  for (size_t i = 0; i < m_hNuclides.size(); i++)
+    if (m_hNuclides[i] == hName) return (G4int)i;
+  return -1;
+}
+
+G4int Xenon1tDecayTable::GetNuclideSegment(G4int iNuclide) const {
+  G4int iSegment = 0;
+  while (iSegment + 1 < (G4int)m_hSegmentOffsets.size() &&
+         m_hSegmentOffsets[iSegment + 1] <= iNuclide)
+    iSegment++;
+  return iSegment;
+}
+
+G4int Xenon1tDecayTable::AddBetaSpectrum(G4double dEndpoint, G4int iZ,
+                                         G4bool bUnique, G4bool bPositron) {
+  for (size_t i = 0; i < m_hSpectra.size(); i++)
+    if (m_hSpectra[i].dEndpoint == dEndpoint && m_hSpectra[i].iZ == iZ &&
+        m_hSpectra[i].bUnique == bUnique &&
+        m_hSpectra[i].bPositron == bPositron)
+      return (G4int)i;
+
+  // allowed shape N(T) ~ F(Z,W) p W (Q-T)^2 with the non-relativistic Fermi
+  // function, times (p^2 + q^2) for unique first-forbidden transitions
+  const G4int iBins = 500;
+  const G4double dQ = dEndpoint / electron_mass_c2;
+  const G4double dZ = bPositron ? -iZ : iZ;
+
+  BetaSpectrum hSpectrum;
+  hSpectrum.dEndpoint = dEndpoint;
+  hSpectrum.iZ = iZ;
+  hSpectrum.bUnique = bUnique;
+  hSpectrum.bPositron = bPositron;
+  hSpectrum.hEnergies.resize(iBins + 1);
+  hSpectrum.hCumulative.resize(iBins + 1);
+
+  G4double dPrevious = 0.;
+  for (G4int i = 0; i <= iBins; i++) {
+    const G4double dT = dQ * i / iBins;
+    const G4double dW = dT + 1.;
+    const G4double dP = std::sqrt(dW * dW - 1.);
+    const G4double dNu = dQ - dT;
+
+    G4double dDensity = 0.;
+    if (dP > 0.) {
+      const G4double dEta = 2. * M_PI * fine_structure_const * dZ * dW / dP;
+      const G4double dFermi =
+          (std::fabs(dEta) < 1e-9) ? 1. : dEta / (1. - std::exp(-dEta));
+      dDensity = dFermi * dP * dW * dNu * dNu;
+      if (bUnique) dDensity *= dP * dP + dNu * dNu;
+    }
+
+    hSpectrum.hEnergies[i] = dT * electron_mass_c2;
+    hSpectrum.hCumulative[i] =
+        (i == 0) ? 0.
+                 : hSpectrum.hCumulative[i - 1] + 0.5 * (dPrevious + dDensity);
+    dPrevious = dDensity;
+  }
+
+  m_hSpectra.push_back(hSpectrum);
+  return (G4int)m_hSpectra.size() - 1;
+}
+
+G4int Xenon1tDecayTable::SampleRecord(G4int iNuclide) const {
+  vector<G4double>::const_iterator pFirst =
+      m_hCumulative.begin() + m_hNuclideOffsets[iNuclide];
+  vector<G4double>::const_iterator pLast =
+      m_hCumulative.begin() + m_hNuclideOffsets[iNuclide + 1];
+
+  const G4double dRandom = G4UniformRand() * *(pLast - 1);
+  vector<G4double>::const_iterator pRecord =
+      std::upper_bound(pFirst, pLast, dRandom);
+  if (pRecord == pLast) --pRecord;
+  return (G4int)(pRecord - m_hCumulative.begin());
+}
+
+void Xenon1tDecayTable::GetEmissions(G4int iRecord, const Emission *&pFirst,
+                                     const Emission *&pLast) const {
+  pFirst = &m_hEmissions[0] + m_hRecordOffsets[iRecord];
+  pLast = &m_hEmissions[0] + m_hRecordOffsets[iRecord + 1];
+}
+
+G4double Xenon1tDecayTable::SampleBetaEnergy(G4int iSpectrum) const {
+  const BetaSpectrum &hSpectrum = m_hSpectra[iSpectrum];
+  const vector<G4double> &hCumulative = hSpectrum.hCumulative;
+
+  const G4double dRandom = G4UniformRand() * hCumulative.back();
+  size_t iBin = std::upper_bound(hCumulative.begin(), hCumulative.end(),
+                                 dRandom) -
+                hCumulative.begin();
+  if (iBin == 0) iBin = 1;
+  if (iBin >= hCumulative.size()) iBin = hCumulative.size() - 1;
+
+  const G4double dLow = hCumulative[iBin - 1];
+  const G4double dHigh = hCumulative[iBin];
+  const G4double dFraction =
+      (dHigh > dLow) ? (dRandom - dLow) / (dHigh - dLow) : 0.;
+  return hSpectrum.hEnergies[iBin - 1] +
+         dFraction * (hSpectrum.hEnergies[iBin] - hSpectrum.hEnergies[iBin - 1]);
+}
@@ -0,0 +1,113 @@
+#ifndef __XENON1TDECAYTABLE_H__
+#define __XENON1TDECAYTABLE_H__
+
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+// Flat, pre-tabulated decay products of one chain segment (e.g. Co60, or
+// U238->Th230) or of a whole chain made of segments. The text table is read
+// once and cached; every decay record keeps the emissions of one decay
+// together so that cascades stay correlated.
+//
+// Table format (energies in keV, decay intensities per decay of the nuclide;
+// the optional number after the nuclide name is its activity relative to the
+// first nuclide of the segment in secular equilibrium, i.e. the branching
+// into it, 1 by default):
+//
+//   nuclide Co60 1
+//   decay 99.88
+//   beta 317.9 28
+//   gamma 1173.228
+//   gamma 1332.492
+//
+// Emission types are gamma, xray, electron (conversion/Auger), alpha, beta
+// and positron. Beta lines give the endpoint and the daughter Z; an optional
+// third field "1u" selects the unique first-forbidden shape (K40).
+//
+// A whole-chain table only lists its segments, each read from <name>.dat in
+// the same directory, with the activity of the first nuclide of the segment
+// relative to the chain parent (1 by default):
+//
+//   segment U238 1     # U238 - Th230
+//   segment Ra226 1    # Ra226 - Pb206
+//
+// The nuclide activities of a segment are scaled by that number, so a
+// chain broken at a segment boundary is the chain table with another segment
+// activity (or /xe/gun/decay/activity on its members).
+
+class Xenon1tDecayTable {
+ public:
+  enum EmissionType { eGamma, eXray, eElectron, eAlpha, eBeta, ePositron };
+
+  struct Emission {
+    G4int iType;
+    G4double dEnergy;
+    G4int iSpectrum;
+  };
+
+  static Xenon1tDecayTable *GetTable(const G4String &hFileName);
+
+  const G4String &GetFileName() const { return m_hFileName; }
+  G4int GetNumberOfNuclides() const { return (G4int)m_hNuclides.size(); }
+  const G4String &GetNuclideName(G4int iNuclide) const {
+    return m_hNuclides[iNuclide];
+  }
+  G4int GetNuclideIndex(const G4String &hName) const;
+  G4int GetNumberOfSegments() const { return (G4int)m_hSegments.size(); }
+  const G4String &GetSegmentName(G4int iSegment) const {
+    return m_hSegments[iSegment];
+  }
+  G4int GetNuclideSegment(G4int iNuclide) const;
+  G4double GetEquilibriumActivity(G4int iNuclide) const {
+    return m_hEquilibriumActivity[iNuclide];
+  }
+  G4int GetNumberOfRecords() const { return (G4int)m_hRecordNuclide.size(); }
+  G4int GetRecordNuclide(G4int iRecord) const {
+    return m_hRecordNuclide[iRecord];
+  }
+
+  G4int SampleRecord(G4int iNuclide) const;
+  void GetEmissions(G4int iRecord, const Emission *&pFirst,
+                    const Emission *&pLast) const;
+  G4double SampleBetaEnergy(G4int iSpectrum) const;
+
+ private:
+  Xenon1tDecayTable(const G4String &hFileName);
+  ~Xenon1tDecayTable();
+
+  void ReadTable();
+  void ReadFile(const G4String &hFileName, G4double dActivity, G4int iDepth);
+  G4int AddBetaSpectrum(G4double dEndpoint, G4int iZ, G4bool bUnique,
+                        G4bool bPositron);
+
+  struct BetaSpectrum {
+    G4double dEndpoint;
+    G4int iZ;
+    G4bool bUnique;
+    G4bool bPositron;
+    vector<G4double> hEnergies;
+    vector<G4double> hCumulative;
+  };
+
+  static map<G4String, Xenon1tDecayTable *> m_hTables;
+
+  G4String m_hFileName;
+
+  vector<G4String> m_hSegments;
+  vector<G4int> m_hSegmentOffsets;
+  vector<G4String> m_hNuclides;
+  vector<G4double> m_hEquilibriumActivity;
+  vector<G4int> m_hNuclideOffsets;
+  vector<G4int> m_hRecordNuclide;
+  vector<G4double> m_hCumulative;
+  vector<G4int> m_hRecordOffsets;
+  vector<Emission> m_hEmissions;
+  vector<BetaSpectrum> m_hSpectra;
+};
+
+#endif
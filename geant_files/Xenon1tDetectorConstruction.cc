@@ -1,17 +1,34 @@
 // XENON Header Files
 #include "Xenon1tDetectorConstruction.hh"
+#include "Xenon1tCheckpoint.hh"
 #include "Xenon1tDetectorMessenger.hh"
+#include "Xenon1tEventFilter.hh"
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tForcedCollision.hh"
+#include "Xenon1tForkRunner.hh"
+#include "Xenon1tGeometryUtilities.hh"
 #include "Xenon1tGridParameterisation.hh"
+#include "Xenon1tHitClusterer.hh"
+#include "Xenon1tImportanceMap.hh"
+#include "Xenon1tKillZones.hh"
 #include "Xenon1tLScintSensitiveDetector.hh"
 #include "Xenon1tLXeSensitiveDetector.hh"
 #include "Xenon1tMaterials.hh"
 #include "Xenon1tPMTsR8520.hh"
+#include "Xenon1tPhysicsProfile.hh"
+#include "Xenon1tPhysicsTableCache.hh"
+#include "Xenon1tRangeRejection.hh"
+#include "Xenon1tRegions.hh"
+#include "Xenon1tStackingRules.hh"
+#include "Xenon1tSubRegions.hh"
 #include "Xenon1tTPC.hh"
+#include "Xenon1tWoodcockTracking.hh"
 #include "XenonNtTPC.hh"
 
 // Additional Header Files
 #include <algorithm>
 #include <cassert>
+#include <cfloat>
 #include <cmath>
 #include <globals.hh>
 #include <numeric>
@@ -40,6 +57,7 @@ using std::vector;
 #include <G4GenericTrap.hh>
 #include <G4IntersectionSolid.hh>
 #include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
 #include <G4Material.hh>
 #include <G4NistManager.hh>
 #include <G4OpBoundaryProcess.hh>
@@ -51,6 +69,7 @@ using std::vector;
 #include <G4SDManager.hh>
 #include <G4Sphere.hh>
 #include <G4SubtractionSolid.hh>
+#include <G4Threading.hh>
 #include <G4ThreeVector.hh>
 #include <G4Torus.hh>
 #include <G4Trd.hh>
@@ -73,6 +92,22 @@ Xenon1tDetectorConstruction::Xenon1tDetectorConstruction(
   pnVetoConfiguration = "None";
 
   m_pDetectorMessenger = new Xenon1tDetectorMessenger(this);
+  Xenon1tSubRegions::GetInstance();
+  Xenon1tRegions::GetInstance();
+  Xenon1tImportanceMap::GetInstance();
+  Xenon1tForcedCollision::GetInstance();
+  Xenon1tWoodcockTracking::GetInstance();
+  // physics options are set in the preinit macro, before the physics is built
+  Xenon1tPhysicsProfile::GetInstance();
+  Xenon1tPhysicsTableCache::GetInstance();
+  Xenon1tForkRunner::GetInstance();
+  Xenon1tEventRandom::GetInstance();
+  Xenon1tCheckpoint::GetInstance();
+  Xenon1tEventFilter::GetInstance();
+  Xenon1tStackingRules::GetInstance();
+  Xenon1tKillZones::GetInstance();
+  Xenon1tRangeRejection::GetInstance();
+  Xenon1tHitClusterer::GetInstance();
 
   detRootFile = fName;
 
@@ -228,11 +263,99 @@ G4VPhysicalVolume *Xenon1tDetectorConstruction::Construct() {
 
   if (pCheckOverlap) OverlapCheck();
 
-  MakeDetectorPlots();
+  // in MT mode Construct() runs on the master only, which writes the
+  // geometry file; the workers share the geometry
+  if (G4Threading::IsMasterThread()) MakeDetectorPlots();
+
+  // the regions first: the Woodcock envelope keeps the region it is in
+  Xenon1tRegions::GetInstance()->Construct();
+  Xenon1tWoodcockTracking::GetInstance()->ConstructRegion();
 
   return m_pWorldPhysicalVolume;
 }
 
+void Xenon1tDetectorConstruction::ConstructSDandField() {
+  // Everything that is per thread: sensitive detectors, biasing operators,
+  // importance store and fast simulation models. Called on every worker in
+  // MT mode (after Construct() on the master) and once in sequential mode.
+  G4SDManager *pSDManager = G4SDManager::GetSDMpointer();
+
+  //_____ xenon sensitivity _____
+  G4VSensitiveDetector *pLXeSD =
+      pSDManager->FindSensitiveDetector("Xenon1t/LXeSD", false);
+  if (!pLXeSD) {
+    pLXeSD = new Xenon1tLXeSensitiveDetector("Xenon1t/LXeSD");
+    pSDManager->AddNewDetector(pLXeSD);
+  }
+  AttachSensitiveDetector("XenonLogicalVolume", pLXeSD);
+  AttachSensitiveDetector("GXeLogicalVolume", pLXeSD);
+
+  //_____ LScint vessel sensitivity (DR 20160906) _____
+  if (pNTversion == "XENONnT" && pnVeto) {
+    G4VSensitiveDetector *pLScintSD =
+        pSDManager->FindSensitiveDetector("Xenon1t/LScintSD", false);
+    if (!pLScintSD) {
+      pLScintSD = new Xenon1tLScintSensitiveDetector("Xenon1t/LScintSD");
+      pSDManager->AddNewDetector(pLScintSD);
+    }
+    AttachSensitiveDetector("LScintVessel_*", pLScintSD);
+  }
+
+  //_____ veto PMT sensitivity _____
+  G4VSensitiveDetector *pPmtSD =
+      pSDManager->FindSensitiveDetector("Xenon1t/PmtSD", false);
+  if (!pPmtSD) {
+    pPmtSD = new Xenon1tPmtSensitiveDetector("Xenon1t/PmtSD");
+    pSDManager->AddNewDetector(pPmtSD);
+  }
+  AttachSensitiveDetector("PMTPhotocathodeVolume", pPmtSD);
+
+  G4VSensitiveDetector *pPmtWindowSD =
+      pSDManager->FindSensitiveDetector("Xenon1t/PmtWindowSD", false);
+  if (!pPmtWindowSD) {
+    pPmtWindowSD = new Xenon1tPmtWindowSensitiveDetector("Xenon1t/PmtWindowSD");
+    pSDManager->AddNewDetector(pPmtWindowSD);
+  }
+  AttachSensitiveDetector("PMTWindowVolume", pPmtWindowSD);
+
+  //_____ variance reduction _____
+  // the settings are shared and made on the master, the importance store,
+  // operator and model are made here for the calling thread
+  Xenon1tImportanceMap *pImportanceMap = Xenon1tImportanceMap::GetInstance();
+  Xenon1tForcedCollision *pForcedCollision =
+      Xenon1tForcedCollision::GetInstance();
+  Xenon1tWoodcockTracking *pWoodcock = Xenon1tWoodcockTracking::GetInstance();
+  pImportanceMap->ApplyImportances(m_pWorldPhysicalVolume);
+  pForcedCollision->AttachToVolume();
+  pWoodcock->ConstructModel();
+
+  // a thread without them would run unbiased without a word
+  std::ostringstream hMissing;
+  if (pImportanceMap->IsActive() &&
+      !pImportanceMap->IsApplied(m_pWorldPhysicalVolume))
+    hMissing << " importance store";
+  if (pForcedCollision->IsActive() && !pForcedCollision->IsAttached())
+    hMissing << " forced-collision operator";
+  if (pWoodcock->IsActive() && !pWoodcock->HasModel())
+    hMissing << " Woodcock model";
+  if (!hMissing.str().empty()) {
+    std::ostringstream hMessage;
+    hMessage << "Active on the master but not built on thread "
+             << G4Threading::G4GetThreadId() << ":" << hMissing.str();
+    G4Exception("Xenon1tDetectorConstruction::ConstructSDandField()",
+                "VarianceReduction", FatalException, hMessage.str().c_str());
+  }
+}
+
+void Xenon1tDetectorConstruction::AttachSensitiveDetector(
+    const G4String &hVolume, G4VSensitiveDetector *pSD) {
+  // the sensitive detector of a logical volume is thread-local data
+  G4LogicalVolumeStore *pStore = G4LogicalVolumeStore::GetInstance();
+  for (size_t i = 0; i < pStore->size(); i++)
+    if (Xenon1tGeometryUtilities::MatchName(hVolume, (*pStore)[i]->GetName()))
+      (*pStore)[i]->SetSensitiveDetector(pSD);
+}
+
 void Xenon1tDetectorConstruction::DefineGeometryParameters() {
   //========== Laboratory ========== //EDIT PAOLO
   m_hGeometryParameters["LabAxisLength"] = 100. * m;
@@ -856,9 +979,13 @@ void Xenon1tDetectorConstruction::DefineGeometryParameters() {
 }
 
 G4double Xenon1tDetectorConstruction::GetGeometryParameter(
-    const char *szParameter) {
-  if (m_hGeometryParameters.find(szParameter) != m_hGeometryParameters.end()) {
-    return m_hGeometryParameters[szParameter];
+    const char *szParameter) const {
+  // read-only: no operator[], which would insert missing keys (and is not
+  // safe when worker threads read the map)
+  map<G4String, G4double>::const_iterator pIt =
+      m_hGeometryParameters.find(szParameter);
+  if (pIt != m_hGeometryParameters.end()) {
+    return pIt->second;
   } else {
     G4cout << "----> Parameter " << szParameter << " is not defined!!!!!"
            << G4endl;
@@ -4045,27 +4172,7 @@ void Xenon1tDetectorConstruction::ConstructLScintVessel() {
   // m_pLScintVesselLogicalVolume, "LScintVessel", m_pWaterLogicalVolume,
   // false, 0);
 
-  //------------------------------ LScint vessel sensitivity
-  //------------------------------ DR 20160906
-  G4SDManager *pSDManager = G4SDManager::GetSDMpointer();
-  Xenon1tLScintSensitiveDetector *pLScintSD =
-      new Xenon1tLScintSensitiveDetector("Xenon1t/LScintSD");
-  pSDManager->AddNewDetector(pLScintSD);
-
-  m_pLScintVesselLogicalVolume_s00->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s01->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s02->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s03->SetSensitiveDetector(pLScintSD);
-
-  m_pLScintVesselLogicalVolume_s10->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s11->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s12->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s13->SetSensitiveDetector(pLScintSD);
-
-  m_pLScintVesselLogicalVolume_s20->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s21->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s22->SetSensitiveDetector(pLScintSD);
-  m_pLScintVesselLogicalVolume_s23->SetSensitiveDetector(pLScintSD);
+  // LScint vessel sensitivity (DR 20160906) in ConstructSDandField()
 
   // redefine mother volume for the cryostat
   m_pMotherLogicalVolume = m_pWaterDisplacerLogicalVolume;
@@ -5040,6 +5147,37 @@ void Xenon1tDetectorConstruction::ConstructColumbiaCryostatNT() {
         m_pOuterCryostatReflectorPhysicalVolume,
         pOpePTFESurface);
 
+  //==== sub-regions ====
+
+  // Same r/z cuts on the primary vertex as divide_outercryo() and
+  // divide_innercryo() in the analysis notebooks (world frame).
+  Xenon1tSubRegions *pSubRegions = Xenon1tSubRegions::GetInstance();
+  pSubRegions->ClearSubRegions("SS_OuterCryostat");
+  pSubRegions->AddSubRegion("SS_OuterCryostat", "OuterCryostatFlange1",
+                            815. * mm, DBL_MAX, 300. * mm, DBL_MAX);
+  pSubRegions->AddSubRegion("SS_OuterCryostat", "OuterCryostatFlange2",
+                            815. * mm, DBL_MAX, -520. * mm, 300. * mm);
+  pSubRegions->AddSubRegion("SS_OuterCryostat", "OuterCryostatFlange3",
+                            815. * mm, DBL_MAX, -1000. * mm, -520. * mm);
+  pSubRegions->AddSubRegion("SS_OuterCryostat", "OuterCryostatElongation",
+                            0., 815. * mm, -360. * mm, 20. * mm);
+  pSubRegions->AddSubRegion("SS_OuterCryostat", "OuterCryostatShell",
+                            0., 815. * mm, -DBL_MAX, DBL_MAX);
+
+  pSubRegions->ClearSubRegions("SS_InnerCryostat");
+  pSubRegions->AddSubRegion("SS_InnerCryostat", "InnerCryostatFlange1",
+                            735. * mm, DBL_MAX, 125. * mm, DBL_MAX);
+  pSubRegions->AddSubRegion("SS_InnerCryostat", "InnerCryostatFlange2",
+                            735. * mm, DBL_MAX, -500. * mm, 125. * mm);
+  pSubRegions->AddSubRegion("SS_InnerCryostat", "InnerCryostatFlange3",
+                            735. * mm, DBL_MAX, -1000. * mm, -500. * mm);
+  pSubRegions->AddSubRegion("SS_InnerCryostat", "InnerCryostatBottomDome",
+                            0., 735. * mm, -DBL_MAX, -1654. * mm);
+  pSubRegions->AddSubRegion("SS_InnerCryostat", "InnerCryostatShell",
+                            0., 735. * mm, -DBL_MAX, DBL_MAX);
+
+  if (m_iVerbosityLevel >= 1) pSubRegions->PrintSubRegions();
+
   //==== attributes ====
   G4Colour hSS316TiColor(0.600, 0.600, 0.600, 0.1);
   G4VisAttributes *pTitaniumVisAtt = new G4VisAttributes(hSS316TiColor);
@@ -5324,34 +5462,7 @@ void Xenon1tDetectorConstruction::ConstructVetoPMTArrays() {
                                OpPMTBaseSurface);
   }
 
-  //========== PMT sensitivity ==========
-  G4SDManager *pSDManager = G4SDManager::GetSDMpointer();
-
-  if (pSDManager->GetCollectionID("PmtHitsCollection") == -1) {
-    // Add new sensitive det
-    pPmtSD = new Xenon1tPmtSensitiveDetector("Xenon1t/PmtSD");
-    pSDManager->AddNewDetector(pPmtSD);
-    m_pPMTPhotocathodeLogicalVolume->SetSensitiveDetector(pPmtSD);
-  } else {
-    // use old sensitive det
-    G4VSensitiveDetector *pPmtSD =
-        pSDManager->FindSensitiveDetector("Xenon1t/PmtSD", true);
-    m_pPMTPhotocathodeLogicalVolume->SetSensitiveDetector(pPmtSD);
-  }
-
-  G4SDManager *pSDWindowManager = G4SDManager::GetSDMpointer();
-
-  if (pSDWindowManager->GetCollectionID("PmtWindowHitsCollection") == -1) {
-    // Add new sensitive det
-    pPmtWindowSD = new Xenon1tPmtWindowSensitiveDetector("Xenon1t/PmtWindowSD");
-    pSDWindowManager->AddNewDetector(pPmtWindowSD);
-    m_pPMTWindowLogicalVolume->SetSensitiveDetector(pPmtWindowSD);
-  } else {
-    // use old sensitive det
-    G4VSensitiveDetector *pPmtWindowSD =
-        pSDWindowManager->FindSensitiveDetector("Xenon1t/PmtWindowSD", true);
-    m_pPMTWindowLogicalVolume->SetSensitiveDetector(pPmtWindowSD);
-  }
+  //========== PMT sensitivity in ConstructSDandField() ==========
 
   //==== attributes ====
   m_pPMTPhotocathodeInterior1LogicalVolume->SetVisAttributes(
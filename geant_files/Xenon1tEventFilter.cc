@@ -0,0 +1,141 @@
+// XENON Header Files
+#include "Xenon1tEventFilter.hh"
+#include "Xenon1tEventFilterMessenger.hh"
+
+// Additional Header Files
+#include <algorithm>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4EventManager.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tEventFilter *Xenon1tEventFilter::m_pInstance = 0;
+
+Xenon1tEventFilter *Xenon1tEventFilter::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tEventFilter();
+  return m_pInstance;
+}
+
+Xenon1tEventFilter::Xenon1tEventFilter() {
+  m_bActive = false;
+  m_dMaxEnergy = 200. * keV;
+  m_dRMax = 607.34 * mm;
+  m_dZMin = -1315. * mm;
+  m_dZMax = -106. * mm;
+  m_dSeparation = 0.;
+  m_dThreshold = 1. * keV;
+
+  m_iEventId = -1;
+  m_bAborted = false;
+  m_dFiducialEnergy = 0.;
+
+  m_dEvents = 0.;
+  m_dEnergyAborted = 0.;
+  m_dMultipleAborted = 0.;
+
+  m_pMessenger = new Xenon1tEventFilterMessenger(this);
+}
+
+Xenon1tEventFilter::~Xenon1tEventFilter() { delete m_pMessenger; }
+
+void Xenon1tEventFilter::SetFiducialVolume(G4double dRMax, G4double dZMin,
+                                           G4double dZMax) {
+  m_dRMax = dRMax;
+  m_dZMin = dZMin;
+  m_dZMax = dZMax;
+}
+
+void Xenon1tEventFilter::BeginEvent(G4int iEventId) {
+  m_iEventId = iEventId;
+  m_bAborted = false;
+  m_dFiducialEnergy = 0.;
+  m_hScatters.clear();
+  m_dEvents += 1.;
+}
+
+G4bool Xenon1tEventFilter::ProcessDeposit(const G4ThreeVector &hPosition,
+                                          G4double dEnergy) {
+  if (!m_bActive || dEnergy <= 0.) return false;
+
+  const G4Event *pEvent =
+      G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  if (pEvent->GetEventID() != m_iEventId) BeginEvent(pEvent->GetEventID());
+  if (m_bAborted) return true;
+
+  if (hPosition.perp() > m_dRMax || hPosition.z() < m_dZMin ||
+      hPosition.z() > m_dZMax)
+    return false;
+
+  m_dFiducialEnergy += dEnergy;
+  if (m_dFiducialEnergy > m_dMaxEnergy) {
+    Abort(m_dEnergyAborted);
+    return true;
+  }
+
+  if (m_dSeparation <= 0.) return false;
+
+  AddScatter(hPosition.z(), dEnergy);
+  G4int iScatters = 0;
+  for (size_t i = 0; i < m_hScatters.size(); i++)
+    if (m_hScatters[i].dEnergy >= m_dThreshold) iScatters++;
+  if (iScatters > 1) {
+    Abort(m_dMultipleAborted);
+    return true;
+  }
+  return false;
+}
+
+G4bool Xenon1tEventFilter::IsRejected() const {
+  if (!m_bActive || !m_bAborted) return false;
+  const G4Event *pEvent =
+      G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  return pEvent && pEvent->GetEventID() == m_iEventId;
+}
+
+void Xenon1tEventFilter::AddScatter(G4double dZ, G4double dEnergy) {
+  // single linkage in z: the deposit joins (and may bridge) every scatter
+  // closer than the separation
+  Scatter hScatter = {dZ, dZ, dEnergy};
+  vector<Scatter> hScatters;
+  for (size_t i = 0; i < m_hScatters.size(); i++) {
+    const Scatter &hOther = m_hScatters[i];
+    if (dZ > hOther.dZMax + m_dSeparation ||
+        dZ < hOther.dZMin - m_dSeparation) {
+      hScatters.push_back(hOther);
+      continue;
+    }
+    hScatter.dZMin = std::min(hScatter.dZMin, hOther.dZMin);
+    hScatter.dZMax = std::max(hScatter.dZMax, hOther.dZMax);
+    hScatter.dEnergy += hOther.dEnergy;
+  }
+  hScatters.push_back(hScatter);
+  m_hScatters.swap(hScatters);
+}
+
+void Xenon1tEventFilter::Abort(G4double &dCounter) {
+  m_bAborted = true;
+  dCounter += 1.;
+  G4EventManager::GetEventManager()->AbortCurrentEvent();
+}
+
+void Xenon1tEventFilter::PrintSettings() const {
+  G4cout << "Xenon1tEventFilter: " << (m_bActive ? "active" : "inactive")
+         << ", FV r < " << m_dRMax / mm << " mm, " << m_dZMin / mm
+         << " < z < " << m_dZMax / mm << " mm, Ed < " << m_dMaxEnergy / keV
+         << " keV";
+  if (m_dSeparation > 0.)
+    G4cout << ", scatters above " << m_dThreshold / keV << " keV and "
+           << m_dSeparation / mm << " mm apart";
+  G4cout << G4endl;
+}
+
+void Xenon1tEventFilter::PrintStatistics() const {
+  if (!m_bActive) return;
+  G4cout << "Xenon1tEventFilter: " << m_dEvents << " events with LXe "
+         << "deposits, " << m_dEnergyAborted << " aborted above "
+         << m_dMaxEnergy / keV << " keV in the FV, " << m_dMultipleAborted
+         << " aborted as multiple scatters" << G4endl;
+}
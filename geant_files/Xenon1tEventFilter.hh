@@ -0,0 +1,86 @@
+#ifndef __XENON1TEVENTFILTER_H__
+#define __XENON1TEVENTFILTER_H__
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tEventFilterMessenger;
+
+// Early termination of events that cannot pass the ER selection (single
+// scatter in the FV with 0 < Ed < maxEnergy). The LXe sensitive detector
+// passes every deposit to ProcessDeposit(), and the event is aborted
+// (G4EventManager::AbortCurrentEvent, the rest of it is not tracked) as
+// soon as
+//
+//  - the energy deposited inside the FV exceeds maxEnergy: the cluster(s)
+//    in the FV can only grow, so either ns > 1 or Ed > maxEnergy. This cut
+//    is exact.
+//  - (optional, /Xe/filter/separation > 0) two scatters in the FV, each
+//    above the threshold, are further apart in z than the separation.
+//    Later deposits could still bridge the gap and make one cluster, so
+//    this cut is approximate; use a separation well above the clustering
+//    distance of nSort.
+//
+// The FV defaults are those of fv() in functions.ipynb (world frame).
+// Aborted events are counted per reason; the analysis manager skips
+// aborted events (G4Event::IsAborted()) and the run action calls
+// PrintStatistics(). The events still count as generated for the
+// normalisation. Not for runs with track splitting (forced collision,
+// importance biasing): aborting the event drops all of its weighted copies.
+
+class Xenon1tEventFilter {
+ public:
+  static Xenon1tEventFilter *GetInstance();
+  ~Xenon1tEventFilter();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetMaxEnergy(G4double dMaxEnergy) { m_dMaxEnergy = dMaxEnergy; }
+  void SetFiducialVolume(G4double dRMax, G4double dZMin, G4double dZMax);
+  void SetSeparation(G4double dSeparation) { m_dSeparation = dSeparation; }
+  void SetThreshold(G4double dThreshold) { m_dThreshold = dThreshold; }
+
+  // returns true if the event was aborted
+  G4bool ProcessDeposit(const G4ThreeVector &hPosition, G4double dEnergy);
+  G4bool IsRejected() const;
+
+  void PrintSettings() const;
+  void PrintStatistics() const;
+
+ private:
+  Xenon1tEventFilter();
+
+  void BeginEvent(G4int iEventId);
+  void AddScatter(G4double dZ, G4double dEnergy);
+  void Abort(G4double &dCounter);
+
+  struct Scatter {
+    G4double dZMin, dZMax;
+    G4double dEnergy;
+  };
+
+  static G4ThreadLocal Xenon1tEventFilter *m_pInstance;
+
+  G4bool m_bActive;
+  G4double m_dMaxEnergy;
+  G4double m_dRMax, m_dZMin, m_dZMax;
+  G4double m_dSeparation;
+  G4double m_dThreshold;
+
+  G4int m_iEventId;
+  G4bool m_bAborted;
+  G4double m_dFiducialEnergy;
+  vector<Scatter> m_hScatters;
+
+  G4double m_dEvents;
+  G4double m_dEnergyAborted;
+  G4double m_dMultipleAborted;
+
+  Xenon1tEventFilterMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,112 @@
+// XENON Header Files
+#include "Xenon1tEventFilterMessenger.hh"
+#include "Xenon1tEventFilter.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tEventFilterMessenger::Xenon1tEventFilterMessenger(
+    Xenon1tEventFilter *pFilter)
+    : m_pFilter(pFilter) {
+  m_pFilterDir = new G4UIdirectory("/Xe/filter/");
+  m_pFilterDir->SetGuidance("Abort events that cannot pass the ER cuts.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/filter/setActive", this);
+  m_pActiveCmd->SetGuidance("Abort events failing the selection on the fly.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pMaxEnergyCmd = new G4UIcmdWithADoubleAndUnit("/Xe/filter/maxEnergy", this);
+  m_pMaxEnergyCmd->SetGuidance("Upper bound of the ROI, abort once the FV "
+                               "deposit exceeds it.");
+  m_pMaxEnergyCmd->SetParameterName("energy", false);
+  m_pMaxEnergyCmd->SetRange("energy > 0.");
+  m_pMaxEnergyCmd->SetDefaultUnit("keV");
+  m_pMaxEnergyCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pFiducialCmd = new G4UIcommand("/Xe/filter/fiducial", this);
+  m_pFiducialCmd->SetGuidance("Fiducial cylinder of the selection (world "
+                              "frame).");
+  m_pFiducialCmd->SetGuidance("[usage] /Xe/filter/fiducial rmax zmin zmax "
+                              "unit");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("rmax", 'd', false);
+  m_pFiducialCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmin", 'd', false);
+  m_pFiducialCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmax", 'd', false);
+  m_pFiducialCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pFiducialCmd->SetParameter(pParameter);
+  m_pFiducialCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pSeparationCmd =
+      new G4UIcmdWithADoubleAndUnit("/Xe/filter/separation", this);
+  m_pSeparationCmd->SetGuidance("Abort on two FV scatters further apart in "
+                                "z (approximate), 0 disables.");
+  m_pSeparationCmd->SetParameterName("dz", false);
+  m_pSeparationCmd->SetRange("dz >= 0.");
+  m_pSeparationCmd->SetDefaultUnit("mm");
+  m_pSeparationCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pThresholdCmd = new G4UIcmdWithADoubleAndUnit("/Xe/filter/threshold", this);
+  m_pThresholdCmd->SetGuidance("Energy of a scatter counted as separate.");
+  m_pThresholdCmd->SetParameterName("energy", false);
+  m_pThresholdCmd->SetRange("energy >= 0.");
+  m_pThresholdCmd->SetDefaultUnit("keV");
+  m_pThresholdCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/filter/print", this);
+  m_pPrintCmd->SetGuidance("Print the settings and the aborted events.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tEventFilterMessenger::~Xenon1tEventFilterMessenger() {
+  delete m_pActiveCmd;
+  delete m_pMaxEnergyCmd;
+  delete m_pFiducialCmd;
+  delete m_pSeparationCmd;
+  delete m_pThresholdCmd;
+  delete m_pPrintCmd;
+  delete m_pFilterDir;
+}
+
+void Xenon1tEventFilterMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                              G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pFilter->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pMaxEnergyCmd)
+    m_pFilter->SetMaxEnergy(m_pMaxEnergyCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pFiducialCmd) {
+    G4double dRMax, dZMin, dZMax;
+    G4String hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> dRMax >> dZMin >> dZMax >> hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pFilter->SetFiducialVolume(dRMax * dUnit, dZMin * dUnit, dZMax * dUnit);
+  }
+
+  if (pUIcommand == m_pSeparationCmd)
+    m_pFilter->SetSeparation(m_pSeparationCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pThresholdCmd)
+    m_pFilter->SetThreshold(m_pThresholdCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pPrintCmd) {
+    m_pFilter->PrintSettings();
+    m_pFilter->PrintStatistics();
+  }
+}
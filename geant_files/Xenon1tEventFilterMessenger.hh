@@ -0,0 +1,33 @@
+#ifndef __XENON1TEVENTFILTERMESSENGER_H__
+#define __XENON1TEVENTFILTERMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tEventFilter;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tEventFilterMessenger : public G4UImessenger {
+ public:
+  Xenon1tEventFilterMessenger(Xenon1tEventFilter *pFilter);
+  ~Xenon1tEventFilterMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tEventFilter *m_pFilter;
+
+  G4UIdirectory *m_pFilterDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithADoubleAndUnit *m_pMaxEnergyCmd;
+  G4UIcommand *m_pFiducialCmd;
+  G4UIcmdWithADoubleAndUnit *m_pSeparationCmd;
+  G4UIcmdWithADoubleAndUnit *m_pThresholdCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
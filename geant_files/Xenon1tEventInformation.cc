@@ -0,0 +1,41 @@
+// XENON Header Files
+#include "Xenon1tEventInformation.hh"
+
+// G4 Header Files
+#include <G4Event.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tEventInformation::Xenon1tEventInformation() {
+  m_iSubRegionId = 0;
+  m_hNuclide = "";
+  m_hComponent = "";
+  m_hIsotope = "";
+  m_dStartTime = 0.;
+  m_iEventNumber = -1;
+  m_dWeight = 1.;
+}
+
+Xenon1tEventInformation::~Xenon1tEventInformation() { ; }
+
+Xenon1tEventInformation *Xenon1tEventInformation::GetOrCreate(
+    G4Event *pEvent) {
+  Xenon1tEventInformation *pInformation =
+      dynamic_cast<Xenon1tEventInformation *>(pEvent->GetUserInformation());
+  if (!pInformation) {
+    pInformation = new Xenon1tEventInformation();
+    pEvent->SetUserInformation(pInformation);
+  }
+  return pInformation;
+}
+
+void Xenon1tEventInformation::Print() const {
+  G4cout << "Xenon1tEventInformation: component = " << m_hComponent
+         << ", isotope = " << m_hIsotope
+         << ", sub-region id = " << m_iSubRegionId
+         << ", nuclide = " << m_hNuclide
+         << ", start time = " << m_dStartTime / s << " s"
+         << ", event number = " << m_iEventNumber
+         << ", weight = " << m_dWeight << G4endl;
+}
@@ -0,0 +1,58 @@
+#ifndef __XENON1TEVENTINFORMATION_H__
+#define __XENON1TEVENTINFORMATION_H__
+
+#include <G4VUserEventInformation.hh>
+#include <globals.hh>
+
+class G4Event;
+
+// Per-event bookkeeping attached to the G4Event by the primary generators and
+// read back by the analysis manager when the event is written out.
+
+class Xenon1tEventInformation : public G4VUserEventInformation {
+ public:
+  Xenon1tEventInformation();
+  ~Xenon1tEventInformation();
+
+  static Xenon1tEventInformation *GetOrCreate(G4Event *pEvent);
+
+  void Print() const;
+
+  void SetSubRegionId(G4int iSubRegionId) { m_iSubRegionId = iSubRegionId; }
+  G4int GetSubRegionId() const { return m_iSubRegionId; }
+
+  void SetNuclide(const G4String &hNuclide) { m_hNuclide = hNuclide; }
+  const G4String &GetNuclide() const { return m_hNuclide; }
+
+  // source of the event in mixed-component runs
+  void SetComponent(const G4String &hComponent) { m_hComponent = hComponent; }
+  const G4String &GetComponent() const { return m_hComponent; }
+  void SetIsotope(const G4String &hIsotope) { m_hIsotope = hIsotope; }
+  const G4String &GetIsotope() const { return m_hIsotope; }
+
+  // absolute time of the decay in time-ordered runs (Xenon1tEventTime)
+  void SetStartTime(G4double dStartTime) { m_dStartTime = dStartTime; }
+  G4double GetStartTime() const { return m_dStartTime; }
+
+  // global event number of the counter-based streams (Xenon1tEventRandom),
+  // -1 if not used
+  void SetEventNumber(G4long iEventNumber) { m_iEventNumber = iEventNumber; }
+  G4long GetEventNumber() const { return m_iEventNumber; }
+
+  // biasing weights of the generators multiply; they are carried here only,
+  // the primary vertices keep weight 1 and the track weights are those of
+  // the transport biasing (importance, forced collision)
+  void MultiplyWeight(G4double dWeight) { m_dWeight *= dWeight; }
+  G4double GetWeight() const { return m_dWeight; }
+
+ private:
+  G4int m_iSubRegionId;
+  G4String m_hNuclide;
+  G4String m_hComponent;
+  G4String m_hIsotope;
+  G4double m_dStartTime;
+  G4long m_iEventNumber;
+  G4double m_dWeight;
+};
+
+#endif
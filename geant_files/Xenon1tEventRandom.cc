@@ -0,0 +1,95 @@
+// XENON Header Files
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tEventRandomMessenger.hh"
+#include "Xenon1tForkRunner.hh"
+#include "Xenon1tPhiloxEngine.hh"
+
+// Additional Header Files
+#include <cstdlib>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <Randomize.hh>
+
+G4ThreadLocal Xenon1tEventRandom *Xenon1tEventRandom::m_pInstance = 0;
+
+Xenon1tEventRandom *Xenon1tEventRandom::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tEventRandom();
+  return m_pInstance;
+}
+
+Xenon1tEventRandom::Xenon1tEventRandom() {
+  m_bActive = false;
+  m_iEventId = -1;
+  m_pEngine = new Xenon1tPhiloxEngine();
+  m_pPreviousEngine = 0;
+  SetStream("default", "-", "-");
+
+  // array tasks get their shard from job.sh without extra macros
+  const char *szFirstEvent = std::getenv("XE_FIRST_EVENT");
+  m_iFirstEvent = szFirstEvent ? std::atol(szFirstEvent) : 0;
+
+  m_pMessenger = new Xenon1tEventRandomMessenger(this);
+}
+
+Xenon1tEventRandom::~Xenon1tEventRandom() {
+  SetActive(false);
+  delete m_pEngine;
+  delete m_pMessenger;
+}
+
+void Xenon1tEventRandom::SetActive(G4bool bActive) {
+  m_bActive = bActive;
+  m_iEventId = -1;
+
+  if (bActive && G4Random::getTheEngine() != m_pEngine) {
+    m_pPreviousEngine = G4Random::getTheEngine();
+    G4Random::setTheEngine(m_pEngine);
+  }
+  if (!bActive && m_pPreviousEngine) {
+    if (G4Random::getTheEngine() == m_pEngine)
+      G4Random::setTheEngine(m_pPreviousEngine);
+    m_pPreviousEngine = 0;
+  }
+}
+
+void Xenon1tEventRandom::SetStream(const G4String &hCampaign,
+                                   const G4String &hComponent,
+                                   const G4String &hIsotope) {
+  m_hStream = hCampaign + " " + hComponent + " " + hIsotope;
+
+  // 64 bit FNV-1a of the stream name
+  m_iKey = 14695981039346656037ULL;
+  for (size_t i = 0; i < m_hStream.size(); i++) {
+    m_iKey ^= (unsigned char)m_hStream[i];
+    m_iKey *= 1099511628211ULL;
+  }
+  m_iEventId = -1;
+}
+
+void Xenon1tEventRandom::BeginEvent(G4Event *pEvent) {
+  if (!m_bActive || pEvent->GetEventID() == m_iEventId) return;
+  m_iEventId = pEvent->GetEventID();
+
+  // the worker threads of an MT job have their own (thread-local) engine,
+  // installed at their first event
+  if (G4Random::getTheEngine() != m_pEngine) {
+    m_pPreviousEngine = G4Random::getTheEngine();
+    G4Random::setTheEngine(m_pEngine);
+  }
+
+  // event ids restart at 0 in every forked worker
+  const G4long iEvent = m_iFirstEvent +
+                        Xenon1tForkRunner::GetInstance()->GetFirstEvent() +
+                        pEvent->GetEventID();
+  m_pEngine->SetStream(m_iKey, (unsigned long long)iEvent);
+
+  Xenon1tEventInformation::GetOrCreate(pEvent)->SetEventNumber(iEvent);
+}
+
+void Xenon1tEventRandom::PrintStream() const {
+  G4cout << "Xenon1tEventRandom: " << (m_bActive ? "active" : "inactive")
+         << ", stream \"" << m_hStream << "\" (key " << m_iKey
+         << "), first event " << m_iFirstEvent << G4endl;
+}
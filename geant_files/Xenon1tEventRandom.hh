@@ -0,0 +1,64 @@
+#ifndef __XENON1TEVENTRANDOM_H__
+#define __XENON1TEVENTRANDOM_H__
+
+#include <globals.hh>
+
+class Xenon1tEventRandomMessenger;
+class Xenon1tPhiloxEngine;
+class G4Event;
+namespace CLHEP {
+class HepRandomEngine;
+}
+
+// Counter-based random streams, one per event: with /Xe/random/setActive
+// the engine is a Xenon1tPhiloxEngine keyed by (campaign, component,
+// isotope) of /Xe/random/stream, and every event starts at the head of the
+// stream of its global event number, first event of the shard + event id.
+// The random numbers of an event do not depend on the events simulated
+// before it, so that
+//
+//  - a run can be split into shards of any size (array tasks, forked
+//    workers, threads) that together give exactly the unsharded run,
+//  - a failed shard is rerun alone with its /Xe/random/firstEvent,
+//  - one event is replayed with /Xe/random/firstEvent N and /run/beamOn 1.
+//
+// The first event of the shard is read from the environment (XE_FIRST_EVENT,
+// set by batch_scripts/job.sh) unless set by the macro. The generators call
+// BeginEvent() before their first random number; it acts once per event,
+// whoever calls it first, and stores the global event number in the
+// Xenon1tEventInformation.
+
+class Xenon1tEventRandom {
+ public:
+  static Xenon1tEventRandom *GetInstance();
+  ~Xenon1tEventRandom();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive);
+  void SetStream(const G4String &hCampaign, const G4String &hComponent,
+                 const G4String &hIsotope);
+  void SetFirstEvent(G4long iFirstEvent) { m_iFirstEvent = iFirstEvent; }
+  G4long GetFirstEvent() const { return m_iFirstEvent; }
+
+  void BeginEvent(G4Event *pEvent);
+
+  void PrintStream() const;
+
+ private:
+  Xenon1tEventRandom();
+
+  static G4ThreadLocal Xenon1tEventRandom *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hStream;
+  unsigned long long m_iKey;
+  G4long m_iFirstEvent;
+  G4int m_iEventId;
+
+  Xenon1tPhiloxEngine *m_pEngine;
+  CLHEP::HepRandomEngine *m_pPreviousEngine;
+
+  Xenon1tEventRandomMessenger *m_pMessenger;
+};
+
+#endif
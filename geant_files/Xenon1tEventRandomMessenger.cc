@@ -0,0 +1,88 @@
+// XENON Header Files
+#include "Xenon1tEventRandomMessenger.hh"
+#include "Xenon1tEventRandom.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tEventRandomMessenger::Xenon1tEventRandomMessenger(
+    Xenon1tEventRandom *pEventRandom)
+    : m_pEventRandom(pEventRandom) {
+  m_pRandomDir = new G4UIdirectory("/Xe/random/");
+  m_pRandomDir->SetGuidance("Counter-based random streams, one per event.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/random/setActive", this);
+  m_pActiveCmd->SetGuidance("Start every event at the head of its own "
+                            "stream (replaces /run/random/setRandomSeed).");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pStreamCmd = new G4UIcommand("/Xe/random/stream", this);
+  m_pStreamCmd->SetGuidance("Key of the streams of the run.");
+  m_pStreamCmd->SetGuidance("[usage] /Xe/random/stream campaign component "
+                            "isotope");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("campaign", 's', false);
+  m_pStreamCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("component", 's', true);
+  pParameter->SetDefaultValue("-");
+  m_pStreamCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("isotope", 's', true);
+  pParameter->SetDefaultValue("-");
+  m_pStreamCmd->SetParameter(pParameter);
+  m_pStreamCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pFirstEventCmd = new G4UIcmdWithAString("/Xe/random/firstEvent", this);
+  m_pFirstEventCmd->SetGuidance("Global number of the first event of this "
+                                "shard (default: $XE_FIRST_EVENT or 0).");
+  m_pFirstEventCmd->SetParameterName("event", false);
+  m_pFirstEventCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/random/print", this);
+  m_pPrintCmd->SetGuidance("Print the stream key and the first event.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tEventRandomMessenger::~Xenon1tEventRandomMessenger() {
+  delete m_pActiveCmd;
+  delete m_pStreamCmd;
+  delete m_pFirstEventCmd;
+  delete m_pPrintCmd;
+  delete m_pRandomDir;
+}
+
+void Xenon1tEventRandomMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                              G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pEventRandom->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pStreamCmd) {
+    G4String hCampaign, hComponent, hIsotope;
+    istringstream hStream(hNewValue);
+    hStream >> hCampaign >> hComponent >> hIsotope;
+    m_pEventRandom->SetStream(hCampaign, hComponent, hIsotope);
+  }
+
+  if (pUIcommand == m_pFirstEventCmd) {
+    // beyond the range of G4UIcmdWithAnInteger for large campaigns
+    G4long iFirstEvent = 0;
+    istringstream hStream(hNewValue);
+    if (!(hStream >> iFirstEvent) || iFirstEvent < 0)
+      G4Exception("Xenon1tEventRandomMessenger::SetNewValue()",
+                  "EventRandom", FatalException,
+                  ("Invalid first event " + hNewValue).c_str());
+    m_pEventRandom->SetFirstEvent(iFirstEvent);
+  }
+
+  if (pUIcommand == m_pPrintCmd) m_pEventRandom->PrintStream();
+}
@@ -0,0 +1,31 @@
+#ifndef __XENON1TEVENTRANDOMMESSENGER_H__
+#define __XENON1TEVENTRANDOMMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tEventRandom;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tEventRandomMessenger : public G4UImessenger {
+ public:
+  Xenon1tEventRandomMessenger(Xenon1tEventRandom *pEventRandom);
+  ~Xenon1tEventRandomMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tEventRandom *m_pEventRandom;
+
+  G4UIdirectory *m_pRandomDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pStreamCmd;
+  G4UIcmdWithAString *m_pFirstEventCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
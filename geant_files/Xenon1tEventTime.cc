@@ -0,0 +1,66 @@
+// XENON Header Files
+#include "Xenon1tEventTime.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tEventTimeMessenger.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4Threading.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tEventTime *Xenon1tEventTime::m_pInstance = 0;
+
+Xenon1tEventTime *Xenon1tEventTime::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tEventTime();
+  return m_pInstance;
+}
+
+Xenon1tEventTime::Xenon1tEventTime() {
+  m_bActive = false;
+  m_dRate = 0.;
+  m_dSourceRate = 0.;
+  m_dTime = 0.;
+  m_iEventId = -1;
+
+  // array tasks are the streams, set by SLURM for batch_scripts/job.sh
+  const char *szStreams = std::getenv("SLURM_ARRAY_TASK_COUNT");
+  m_iStreams = szStreams ? std::max(1, std::atoi(szStreams)) : 1;
+
+  m_pMessenger = new Xenon1tEventTimeMessenger(this);
+}
+
+Xenon1tEventTime::~Xenon1tEventTime() { delete m_pMessenger; }
+
+void Xenon1tEventTime::SetStartTime(G4double dStartTime) {
+  m_dTime = dStartTime;
+  m_iEventId = -1;
+}
+
+void Xenon1tEventTime::BeginEvent(G4Event *pEvent) {
+  if (!m_bActive || pEvent->GetEventID() == m_iEventId) return;
+  m_iEventId = pEvent->GetEventID();
+
+  const G4double dRate = GetRate();
+  if (dRate <= 0.) {
+    G4Exception("Xenon1tEventTime::BeginEvent()", "EventTime",
+                FatalException,
+                "No decay rate, use /xe/gun/time/rate or /xe/gun/mixed/table");
+    return;
+  }
+
+  // exponential waiting time of the Poisson process of this task; in MT runs
+  // every worker thread is a stream of its own and writes its own file
+  const G4int iStreams =
+      m_iStreams * std::max(1, G4Threading::GetNumberOfRunningWorkerThreads());
+  m_dTime += -std::log(G4UniformRand()) * iStreams / dRate;
+
+  Xenon1tEventInformation::GetOrCreate(pEvent)->SetStartTime(m_dTime);
+}
@@ -0,0 +1,56 @@
+#ifndef __XENON1TEVENTTIME_H__
+#define __XENON1TEVENTTIME_H__
+
+#include <globals.hh>
+
+class Xenon1tEventTimeMessenger;
+class G4Event;
+
+// Absolute time of the primary decay, for time-ordered background streams.
+// Decays of a source of rate R are a Poisson process; an array job of K
+// tasks runs K independent processes of rate R / K starting at t = 0, whose
+// superposition (python_scripts/merge_stream.py) is the process of rate R.
+// K is taken from SLURM_ARRAY_TASK_COUNT unless set by the macro.
+// Each event advances the clock of its task by an exponential interval and
+// stores the result in the Xenon1tEventInformation as start time.
+//
+// The start time is not added to the vertex time, which stays relative to the
+// decay: tracks (and the decays postponed by /xe/Postponedecay, which keep
+// their Geant4 decay time) are at start time + global time. The rate is set
+// with /xe/gun/time/rate or, if not, taken from the mixed source.
+
+class Xenon1tEventTime {
+ public:
+  static Xenon1tEventTime *GetInstance();
+  ~Xenon1tEventTime();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void SetRate(G4double dRate) { m_dRate = dRate; }
+  void SetSourceRate(G4double dRate) { m_dSourceRate = dRate; }
+  G4double GetRate() const { return (m_dRate > 0.) ? m_dRate : m_dSourceRate; }
+  void SetNumberOfStreams(G4int iStreams) { m_iStreams = iStreams; }
+  G4int GetNumberOfStreams() const { return m_iStreams; }
+  void SetStartTime(G4double dStartTime);
+
+  // advances the clock once per event, whoever calls it first
+  void BeginEvent(G4Event *pEvent);
+  G4double GetTime() const { return m_dTime; }
+
+ private:
+  Xenon1tEventTime();
+
+  static G4ThreadLocal Xenon1tEventTime *m_pInstance;
+
+  G4bool m_bActive;
+  G4double m_dRate;
+  G4double m_dSourceRate;
+  G4int m_iStreams;
+  G4double m_dTime;
+  G4int m_iEventId;
+
+  Xenon1tEventTimeMessenger *m_pMessenger;
+};
+
+#endif
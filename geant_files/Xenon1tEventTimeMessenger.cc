@@ -0,0 +1,69 @@
+// XENON Header Files
+#include "Xenon1tEventTimeMessenger.hh"
+#include "Xenon1tEventTime.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tEventTimeMessenger::Xenon1tEventTimeMessenger(
+    Xenon1tEventTime *pEventTime)
+    : m_pEventTime(pEventTime) {
+  m_pTimeDir = new G4UIdirectory("/xe/gun/time/");
+  m_pTimeDir->SetGuidance("Absolute decay times for time-ordered streams.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/xe/gun/time/setActive", this);
+  m_pActiveCmd->SetGuidance("Draw an absolute start time for every event.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pRateCmd = new G4UIcmdWithADoubleAndUnit("/xe/gun/time/rate", this);
+  m_pRateCmd->SetGuidance("Decay rate of the whole source (all tasks), 0 "
+                          "takes the rate of the mixed source.");
+  m_pRateCmd->SetParameterName("rate", false);
+  m_pRateCmd->SetRange("rate >= 0.");
+  m_pRateCmd->SetDefaultUnit("Bq");
+  m_pRateCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pStreamsCmd = new G4UIcmdWithAnInteger("/xe/gun/time/streams", this);
+  m_pStreamsCmd->SetGuidance("Number of array tasks sharing the source, each "
+                             "runs at rate / streams (default: "
+                             "$SLURM_ARRAY_TASK_COUNT or 1).");
+  m_pStreamsCmd->SetParameterName("streams", false);
+  m_pStreamsCmd->SetRange("streams >= 1");
+  m_pStreamsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pStartTimeCmd =
+      new G4UIcmdWithADoubleAndUnit("/xe/gun/time/startTime", this);
+  m_pStartTimeCmd->SetGuidance("Restart the clock of this task.");
+  m_pStartTimeCmd->SetParameterName("time", false);
+  m_pStartTimeCmd->SetRange("time >= 0.");
+  m_pStartTimeCmd->SetDefaultUnit("s");
+  m_pStartTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tEventTimeMessenger::~Xenon1tEventTimeMessenger() {
+  delete m_pActiveCmd;
+  delete m_pRateCmd;
+  delete m_pStreamsCmd;
+  delete m_pStartTimeCmd;
+  delete m_pTimeDir;
+}
+
+void Xenon1tEventTimeMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                            G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pEventTime->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pRateCmd)
+    m_pEventTime->SetRate(m_pRateCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pStreamsCmd)
+    m_pEventTime->SetNumberOfStreams(m_pStreamsCmd->GetNewIntValue(hNewValue));
+
+  if (pUIcommand == m_pStartTimeCmd)
+    m_pEventTime->SetStartTime(m_pStartTimeCmd->GetNewDoubleValue(hNewValue));
+}
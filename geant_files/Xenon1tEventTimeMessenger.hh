@@ -0,0 +1,31 @@
+#ifndef __XENON1TEVENTTIMEMESSENGER_H__
+#define __XENON1TEVENTTIMEMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tEventTime;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+
+class Xenon1tEventTimeMessenger : public G4UImessenger {
+ public:
+  Xenon1tEventTimeMessenger(Xenon1tEventTime *pEventTime);
+  ~Xenon1tEventTimeMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tEventTime *m_pEventTime;
+
+  G4UIdirectory *m_pTimeDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithADoubleAndUnit *m_pRateCmd;
+  G4UIcmdWithAnInteger *m_pStreamsCmd;
+  G4UIcmdWithADoubleAndUnit *m_pStartTimeCmd;
+};
+
+#endif
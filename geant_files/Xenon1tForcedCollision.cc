@@ -0,0 +1,45 @@
+// XENON Header Files
+#include "Xenon1tForcedCollision.hh"
+#include "Xenon1tForcedCollisionMessenger.hh"
+
+// G4 Header Files
+#include <G4BOptrForceCollision.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+
+Xenon1tForcedCollision *Xenon1tForcedCollision::m_pInstance = 0;
+G4ThreadLocal G4BOptrForceCollision *Xenon1tForcedCollision::m_pOperator = 0;
+
+Xenon1tForcedCollision *Xenon1tForcedCollision::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tForcedCollision();
+  return m_pInstance;
+}
+
+Xenon1tForcedCollision::Xenon1tForcedCollision() {
+  m_bActive = false;
+  m_hVolume = "XenonLogicalVolume";
+  m_hParticle = "gamma";
+
+  m_pMessenger = new Xenon1tForcedCollisionMessenger(this);
+}
+
+Xenon1tForcedCollision::~Xenon1tForcedCollision() { delete m_pMessenger; }
+
+void Xenon1tForcedCollision::AttachToVolume() {
+  if (!m_bActive) return;
+
+  G4LogicalVolume *pVolume =
+      G4LogicalVolumeStore::GetInstance()->GetVolume(m_hVolume);
+  if (!pVolume)
+    G4Exception("Xenon1tForcedCollision::AttachToVolume()", "ForcedCollision",
+                FatalException,
+                ("No logical volume " + m_hVolume).c_str());
+
+  if (!m_pOperator)
+    m_pOperator =
+        new G4BOptrForceCollision(m_hParticle, "ForceCollision" + m_hParticle);
+  m_pOperator->AttachTo(pVolume);
+
+  G4cout << "Xenon1tForcedCollision: forcing " << m_hParticle
+         << " collisions in " << m_hVolume << G4endl;
+}
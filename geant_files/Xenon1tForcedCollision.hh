@@ -0,0 +1,54 @@
+#ifndef __XENON1TFORCEDCOLLISION_H__
+#define __XENON1TFORCEDCOLLISION_H__
+
+#include <globals.hh>
+
+class Xenon1tForcedCollisionMessenger;
+class G4BOptrForceCollision;
+
+// Forced-collision biasing of gammas in the xenon (G4BOptrForceCollision).
+// A gamma entering the volume is cloned: the clone is forced to interact
+// before leaving the volume and carries w (1 - exp(-tau)), the original
+// crosses the volume without interacting and carries w exp(-tau), where tau
+// is the optical depth of its path through the volume. The weights end up
+// in the track weights of the secondaries, hence in the hits.
+//
+// The operator acts on a whole logical volume. The xenon is a single
+// volume (XenonLogicalVolume, the full inner cryostat), so the collision is
+// forced anywhere in the LXe and the FV cut stays in the analysis.
+//
+// The physics list has to wrap the biased particle with
+// G4GenericBiasingPhysics::Bias("gamma").
+//
+// One instance shared by all threads: the settings are made on the master in
+// PreInit and only read by the workers; the biasing operator is per thread
+// and made by AttachToVolume() from ConstructSDandField().
+
+class Xenon1tForcedCollision {
+ public:
+  static Xenon1tForcedCollision *GetInstance();
+  ~Xenon1tForcedCollision();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetVolume(const G4String &hVolume) { m_hVolume = hVolume; }
+  void SetParticle(const G4String &hParticle) { m_hParticle = hParticle; }
+
+  // operator of the calling thread
+  void AttachToVolume();
+  G4bool IsAttached() const { return m_pOperator != 0; }
+
+ private:
+  Xenon1tForcedCollision();
+
+  static Xenon1tForcedCollision *m_pInstance;
+  static G4ThreadLocal G4BOptrForceCollision *m_pOperator;
+
+  G4bool m_bActive;
+  G4String m_hVolume;
+  G4String m_hParticle;
+
+  Xenon1tForcedCollisionMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,53 @@
+// XENON Header Files
+#include "Xenon1tForcedCollisionMessenger.hh"
+#include "Xenon1tForcedCollision.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tForcedCollisionMessenger::Xenon1tForcedCollisionMessenger(
+    Xenon1tForcedCollision *pForcedCollision)
+    : m_pForcedCollision(pForcedCollision) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pForcedCollisionDir = new G4UIdirectory("/Xe/forcedCollision/", false);
+  m_pForcedCollisionDir->SetGuidance("Forced-collision biasing in the "
+                                     "xenon.");
+
+  m_pActiveCmd =
+      new G4UIcmdWithABool("/Xe/forcedCollision/setActive", this);
+  m_pActiveCmd->SetGuidance("Force the first interaction of the particle in "
+                            "the volume.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit);
+
+  m_pVolumeCmd = new G4UIcmdWithAString("/Xe/forcedCollision/volume", this);
+  m_pVolumeCmd->SetGuidance("Logical volume (XenonLogicalVolume).");
+  m_pVolumeCmd->SetParameterName("volume", false);
+  m_pVolumeCmd->AvailableForStates(G4State_PreInit);
+
+  m_pParticleCmd =
+      new G4UIcmdWithAString("/Xe/forcedCollision/particle", this);
+  m_pParticleCmd->SetGuidance("Biased particle (gamma).");
+  m_pParticleCmd->SetParameterName("particle", false);
+  m_pParticleCmd->AvailableForStates(G4State_PreInit);
+}
+
+Xenon1tForcedCollisionMessenger::~Xenon1tForcedCollisionMessenger() {
+  delete m_pActiveCmd;
+  delete m_pVolumeCmd;
+  delete m_pParticleCmd;
+  delete m_pForcedCollisionDir;
+}
+
+void Xenon1tForcedCollisionMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                  G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pForcedCollision->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pVolumeCmd) m_pForcedCollision->SetVolume(hNewValue);
+
+  if (pUIcommand == m_pParticleCmd) m_pForcedCollision->SetParticle(hNewValue);
+}
@@ -0,0 +1,29 @@
+#ifndef __XENON1TFORCEDCOLLISIONMESSENGER_H__
+#define __XENON1TFORCEDCOLLISIONMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tForcedCollision;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+
+class Xenon1tForcedCollisionMessenger : public G4UImessenger {
+ public:
+  Xenon1tForcedCollisionMessenger(Xenon1tForcedCollision *pForcedCollision);
+  ~Xenon1tForcedCollisionMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tForcedCollision *m_pForcedCollision;
+
+  G4UIdirectory *m_pForcedCollisionDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pVolumeCmd;
+  G4UIcmdWithAString *m_pParticleCmd;
+};
+
+#endif
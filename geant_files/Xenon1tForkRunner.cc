@@ -0,0 +1,172 @@
+// XENON Header Files
+#include "Xenon1tForkRunner.hh"
+#include "Xenon1tEventTime.hh"
+#include "Xenon1tForkRunnerMessenger.hh"
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tThreadOutput.hh"
+
+// Additional Header Files
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::ofstream;
+using std::ostringstream;
+
+// G4 Header Files
+#include <G4RunManager.hh>
+#include <Randomize.hh>
+
+Xenon1tForkRunner *Xenon1tForkRunner::m_pInstance = 0;
+
+Xenon1tForkRunner *Xenon1tForkRunner::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tForkRunner();
+  return m_pInstance;
+}
+
+Xenon1tForkRunner::Xenon1tForkRunner() {
+  m_iWorkers = 1;
+  m_hMetadata = "fork_metadata.txt";
+  m_iFirstEvent = 0;
+
+  m_pMessenger = new Xenon1tForkRunnerMessenger(this);
+}
+
+Xenon1tForkRunner::~Xenon1tForkRunner() { delete m_pMessenger; }
+
+void Xenon1tForkRunner::BeamOn(G4int iEvents) {
+  G4RunManager *pRunManager = G4RunManager::GetRunManager();
+  if (m_iWorkers <= 1 || iEvents < m_iWorkers) {
+    pRunManager->BeamOn(iEvents);
+    return;
+  }
+
+  if (pRunManager->GetRunManagerType() != G4RunManager::sequentialRM) {
+    G4Exception("Xenon1tForkRunner::BeamOn()", "ForkRunner", FatalException,
+                "/Xe/fork/workers needs a sequential run manager");
+    return;
+  }
+
+  // build the physics tables before forking (a run without events), so
+  // that the workers share them instead of building one copy each
+  pRunManager->BeamOn(0);
+
+  m_hWorkers.assign(m_iWorkers, Worker());
+  G4int iFirstEvent = 0;
+  for (G4int i = 0; i < m_iWorkers; i++) {
+    Worker &hWorker = m_hWorkers[i];
+    hWorker.iPid = -1;
+    hWorker.iFirstEvent = iFirstEvent;
+    hWorker.iEvents = iEvents / m_iWorkers + (i < iEvents % m_iWorkers);
+    hWorker.iSeeds[0] = (long)(100000000L * G4UniformRand());
+    hWorker.iSeeds[1] = (long)(100000000L * G4UniformRand());
+    hWorker.iStatus = -1;
+    iFirstEvent += hWorker.iEvents;
+  }
+
+  G4cout << "Xenon1tForkRunner: " << iEvents << " events in " << m_iWorkers
+         << " worker processes" << G4endl;
+
+  // nothing buffered may be written twice by the children
+  G4cout.flush();
+  G4cerr.flush();
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  for (G4int i = 0; i < m_iWorkers; i++) {
+    const pid_t iPid = fork();
+    if (iPid == 0) RunWorker(i, m_hWorkers[i]);
+    if (iPid < 0) {
+      G4Exception("Xenon1tForkRunner::BeamOn()", "ForkRunner", JustWarning,
+                  (G4String("fork failed: ") + strerror(errno)).c_str());
+      break;
+    }
+    m_hWorkers[i].iPid = iPid;
+  }
+
+  G4int iFailed = 0;
+  for (G4int i = 0; i < m_iWorkers; i++) {
+    Worker &hWorker = m_hWorkers[i];
+    if (hWorker.iPid < 0) {
+      iFailed++;
+      continue;
+    }
+
+    G4int iWaitStatus = 0;
+    while (waitpid(hWorker.iPid, &iWaitStatus, 0) < 0 && errno == EINTR)
+      ;
+    if (WIFEXITED(iWaitStatus))
+      hWorker.iStatus = WEXITSTATUS(iWaitStatus);
+    else if (WIFSIGNALED(iWaitStatus))
+      hWorker.iStatus = 128 + WTERMSIG(iWaitStatus);
+    if (hWorker.iStatus != 0) iFailed++;
+  }
+
+  WriteMetadata(iEvents);
+
+  if (iFailed) {
+    ostringstream hMessage;
+    hMessage << iFailed << " of " << m_iWorkers
+             << " worker processes failed, see " << m_hMetadata;
+    G4Exception("Xenon1tForkRunner::BeamOn()", "ForkRunner", FatalException,
+                hMessage.str().c_str());
+  }
+}
+
+void Xenon1tForkRunner::RunWorker(G4int iWorker, const Worker &hWorker) {
+  // never returns: the child must not run the rest of the job of the parent
+  Xenon1tThreadOutput::SetProcessId(iWorker);
+  m_iFirstEvent = hWorker.iFirstEvent;
+
+  long iSeeds[3] = {hWorker.iSeeds[0], hWorker.iSeeds[1], 0};
+  G4Random::setTheSeeds(iSeeds, -1);
+
+  // distinct QMC replica and Poisson stream per worker
+  Xenon1tQuasiRandom *pQuasiRandom = Xenon1tQuasiRandom::GetInstance();
+  pQuasiRandom->SetScramble(pQuasiRandom->GetScramble() * m_iWorkers +
+                            iWorker);
+  Xenon1tEventTime *pEventTime = Xenon1tEventTime::GetInstance();
+  pEventTime->SetNumberOfStreams(pEventTime->GetNumberOfStreams() *
+                                 m_iWorkers);
+
+  G4RunManager::GetRunManager()->BeamOn(hWorker.iEvents);
+
+  G4cout.flush();
+  std::cout.flush();
+  fflush(0);
+  _exit(0);
+}
+
+void Xenon1tForkRunner::WriteMetadata(G4int iEvents) const {
+  ofstream hFile(m_hMetadata.c_str());
+  if (!hFile.is_open()) {
+    G4Exception("Xenon1tForkRunner::WriteMetadata()", "ForkRunner",
+                JustWarning, ("Cannot write " + m_hMetadata).c_str());
+    return;
+  }
+
+  G4int iDone = 0;
+  for (size_t i = 0; i < m_hWorkers.size(); i++)
+    if (m_hWorkers[i].iStatus == 0) iDone += m_hWorkers[i].iEvents;
+
+  hFile << "# worker pid first_event events seed1 seed2 status" << std::endl;
+  hFile << "events " << iEvents << std::endl;
+  hFile << "events_done " << iDone << std::endl;
+  hFile << "workers " << m_hWorkers.size() << std::endl;
+  for (size_t i = 0; i < m_hWorkers.size(); i++) {
+    const Worker &hWorker = m_hWorkers[i];
+    hFile << "worker " << i << " " << hWorker.iPid << " "
+          << hWorker.iFirstEvent << " " << hWorker.iEvents << " "
+          << hWorker.iSeeds[0] << " " << hWorker.iSeeds[1] << " "
+          << hWorker.iStatus << std::endl;
+  }
+
+  G4cout << "Xenon1tForkRunner: " << iDone << " of " << iEvents
+         << " events done, metadata in " << m_hMetadata << G4endl;
+}
@@ -0,0 +1,66 @@
+#ifndef __XENON1TFORKRUNNER_H__
+#define __XENON1TFORKRUNNER_H__
+
+#include <globals.hh>
+
+#include <sys/types.h>
+#include <vector>
+
+using std::vector;
+
+class Xenon1tForkRunnerMessenger;
+
+// Multi-process run mode for sequential builds: the job initialises the
+// geometry, physics tables and sources once, then forks /Xe/fork/workers
+// processes that share that memory copy-on-write. Worker i simulates a
+// disjoint range of the events, with its own seeds drawn from the engine of
+// the parent (as G4MTRunManager seeds its threads), its own QMC scramble and
+// event-time stream, and writes its own output file (_p<i>, see
+// Xenon1tThreadOutput). The parent waits for all of them and writes the
+// metadata of the job (event ranges, seeds, exit status of every worker);
+// a failed worker makes the job fail after the metadata is written.
+//
+// main calls Xenon1tForkRunner::BeamOn() instead of G4RunManager::BeamOn(),
+// which is the same when /Xe/fork/workers is 1. Event ids restart at 0 in
+// every worker, the analysis manager adds GetFirstEvent() when it writes
+// them.
+
+class Xenon1tForkRunner {
+ public:
+  static Xenon1tForkRunner *GetInstance();
+  ~Xenon1tForkRunner();
+
+  void SetNumberOfWorkers(G4int iWorkers) { m_iWorkers = iWorkers; }
+  G4int GetNumberOfWorkers() const { return m_iWorkers; }
+  void SetMetadataFile(const G4String &hFileName) { m_hMetadata = hFileName; }
+
+  void BeamOn(G4int iEvents);
+
+  // first event of this process, 0 in the parent and in plain runs
+  G4int GetFirstEvent() const { return m_iFirstEvent; }
+
+ private:
+  Xenon1tForkRunner();
+
+  struct Worker {
+    pid_t iPid;
+    G4int iFirstEvent;
+    G4int iEvents;
+    long iSeeds[2];
+    G4int iStatus;
+  };
+
+  void RunWorker(G4int iWorker, const Worker &hWorker);
+  void WriteMetadata(G4int iEvents) const;
+
+  static Xenon1tForkRunner *m_pInstance;
+
+  G4int m_iWorkers;
+  G4String m_hMetadata;
+  G4int m_iFirstEvent;
+  vector<Worker> m_hWorkers;
+
+  Xenon1tForkRunnerMessenger *m_pMessenger;
+};
+
+#endif
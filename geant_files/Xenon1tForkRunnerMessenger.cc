@@ -0,0 +1,52 @@
+// XENON Header Files
+#include "Xenon1tForkRunnerMessenger.hh"
+#include "Xenon1tForkRunner.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tForkRunnerMessenger::Xenon1tForkRunnerMessenger(
+    Xenon1tForkRunner *pRunner)
+    : m_pRunner(pRunner) {
+  m_pForkDir = new G4UIdirectory("/Xe/fork/");
+  m_pForkDir->SetGuidance("Forked worker processes after initialisation.");
+
+  m_pWorkersCmd = new G4UIcmdWithAnInteger("/Xe/fork/workers", this);
+  m_pWorkersCmd->SetGuidance("Number of worker processes (1: no fork).");
+  m_pWorkersCmd->SetParameterName("workers", false);
+  m_pWorkersCmd->SetRange("workers >= 1");
+  m_pWorkersCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pMetadataCmd = new G4UIcmdWithAString("/Xe/fork/metadata", this);
+  m_pMetadataCmd->SetGuidance("File of event ranges, seeds and status of "
+                              "the workers.");
+  m_pMetadataCmd->SetParameterName("file", false);
+  m_pMetadataCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pBeamOnCmd = new G4UIcmdWithAnInteger("/Xe/fork/beamOn", this);
+  m_pBeamOnCmd->SetGuidance("/run/beamOn split over the worker processes.");
+  m_pBeamOnCmd->SetParameterName("events", false);
+  m_pBeamOnCmd->SetRange("events >= 0");
+  m_pBeamOnCmd->AvailableForStates(G4State_Idle);
+}
+
+Xenon1tForkRunnerMessenger::~Xenon1tForkRunnerMessenger() {
+  delete m_pWorkersCmd;
+  delete m_pMetadataCmd;
+  delete m_pBeamOnCmd;
+  delete m_pForkDir;
+}
+
+void Xenon1tForkRunnerMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                             G4String hNewValue) {
+  if (pUIcommand == m_pWorkersCmd)
+    m_pRunner->SetNumberOfWorkers(m_pWorkersCmd->GetNewIntValue(hNewValue));
+
+  if (pUIcommand == m_pMetadataCmd) m_pRunner->SetMetadataFile(hNewValue);
+
+  if (pUIcommand == m_pBeamOnCmd)
+    m_pRunner->BeamOn(m_pBeamOnCmd->GetNewIntValue(hNewValue));
+}
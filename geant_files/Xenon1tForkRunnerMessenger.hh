@@ -0,0 +1,29 @@
+#ifndef __XENON1TFORKRUNNERMESSENGER_H__
+#define __XENON1TFORKRUNNERMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tForkRunner;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+
+class Xenon1tForkRunnerMessenger : public G4UImessenger {
+ public:
+  Xenon1tForkRunnerMessenger(Xenon1tForkRunner *pRunner);
+  ~Xenon1tForkRunnerMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tForkRunner *m_pRunner;
+
+  G4UIdirectory *m_pForkDir;
+  G4UIcmdWithAnInteger *m_pWorkersCmd;
+  G4UIcmdWithAString *m_pMetadataCmd;
+  G4UIcmdWithAnInteger *m_pBeamOnCmd;
+};
+
+#endif
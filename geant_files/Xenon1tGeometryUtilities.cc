@@ -0,0 +1,87 @@
+// XENON Header Files
+#include "Xenon1tGeometryUtilities.hh"
+
+// G4 Header Files
+#include <G4LogicalVolume.hh>
+#include <G4Navigator.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+
+G4bool Xenon1tGeometryUtilities::MatchName(const G4String &hPattern,
+                                           const G4String &hName) {
+  const size_t iLength = hPattern.length();
+  if (iLength > 0 && hPattern[iLength - 1] == '*')
+    return hName.compare(0, iLength - 1, hPattern, 0, iLength - 1) == 0;
+  return hName == hPattern;
+}
+
+vector<Xenon1tGeometryUtilities::Placement>
+Xenon1tGeometryUtilities::FindPlacements(const G4String &hPattern) {
+  vector<Placement> hPlacements;
+
+  G4VPhysicalVolume *pWorld = G4TransportationManager::GetTransportationManager()
+                                  ->GetNavigatorForTracking()
+                                  ->GetWorldVolume();
+  if (!pWorld) return hPlacements;
+
+  if (MatchName(hPattern, pWorld->GetName())) {
+    Placement hPlacement;
+    hPlacement.pVolume = pWorld;
+    hPlacement.hToWorld = G4Transform3D();
+    hPlacements.push_back(hPlacement);
+  }
+  CollectPlacements(pWorld->GetLogicalVolume(), G4Transform3D(), hPattern,
+                    hPlacements);
+
+  return hPlacements;
+}
+
+G4VPhysicalVolume *Xenon1tGeometryUtilities::FindTarget(
+    const G4String &hPattern, const G4String &hCaller,
+    const G4String &hConsequence, G4Transform3D &hWorldToTarget) {
+  vector<Placement> hPlacements = FindPlacements(hPattern);
+  if (hPlacements.empty()) {
+    G4Exception(hCaller.c_str(), "GeometryUtilities", JustWarning,
+                ("No volume " + hPattern + ", " + hConsequence).c_str());
+    return 0;
+  }
+
+  hWorldToTarget = hPlacements[0].hToWorld.inverse();
+  return hPlacements[0].pVolume;
+}
+
+G4double Xenon1tGeometryUtilities::GetDistanceToTarget(
+    const G4VPhysicalVolume *pTarget, const G4Transform3D &hWorldToTarget,
+    const G4ThreeVector &hPosition) {
+  if (!pTarget) return 0.;
+
+  return pTarget->GetLogicalVolume()->GetSolid()->DistanceToIn(
+      ToWorld(hWorldToTarget, hPosition));
+}
+
+void Xenon1tGeometryUtilities::CollectPlacements(
+    G4LogicalVolume *pMother, const G4Transform3D &hMotherToWorld,
+    const G4String &hPattern, vector<Placement> &hPlacements) {
+  for (G4int i = 0; i < pMother->GetNoDaughters(); i++) {
+    G4VPhysicalVolume *pDaughter = pMother->GetDaughter(i);
+
+    // replicas and parameterised volumes (meshes, PMT arrays) have no single
+    // transform and are not used as sources
+    if (pDaughter->IsReplicated()) continue;
+
+    const G4Transform3D hToWorld =
+        hMotherToWorld * G4Transform3D(pDaughter->GetObjectRotationValue(),
+                                       pDaughter->GetObjectTranslation());
+
+    if (MatchName(hPattern, pDaughter->GetName())) {
+      Placement hPlacement;
+      hPlacement.pVolume = pDaughter;
+      hPlacement.hToWorld = hToWorld;
+      hPlacements.push_back(hPlacement);
+    }
+
+    CollectPlacements(pDaughter->GetLogicalVolume(), hToWorld, hPattern,
+                      hPlacements);
+  }
+}
@@ -0,0 +1,54 @@
+#ifndef __XENON1TGEOMETRYUTILITIES_H__
+#define __XENON1TGEOMETRYUTILITIES_H__
+
+#include <G4ThreeVector.hh>
+#include <G4Transform3D.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+
+// Helpers to find placed volumes by name after construction, with the
+// daughter-to-world transform of every placement.
+
+class Xenon1tGeometryUtilities {
+ public:
+  struct Placement {
+    G4VPhysicalVolume *pVolume;
+    G4Transform3D hToWorld;
+  };
+
+  // same wildcard convention as /xe/gun/confine: "Copper_FieldGuard_*"
+  static G4bool MatchName(const G4String &hPattern, const G4String &hName);
+
+  static vector<Placement> FindPlacements(const G4String &hPattern);
+
+  // first placement of a volume used as a distance target, 0 (and a warning
+  // from hCaller ending with hConsequence) if there is none
+  static G4VPhysicalVolume *FindTarget(const G4String &hPattern,
+                                       const G4String &hCaller,
+                                       const G4String &hConsequence,
+                                       G4Transform3D &hWorldToTarget);
+
+  // distance from a world point to the solid of a target, 0 inside it
+  static G4double GetDistanceToTarget(const G4VPhysicalVolume *pTarget,
+                                      const G4Transform3D &hWorldToTarget,
+                                      const G4ThreeVector &hPosition);
+
+  static G4ThreeVector ToWorld(const G4Transform3D &hToWorld,
+                               const G4ThreeVector &hLocal) {
+    return hToWorld.getRotation() * hLocal + hToWorld.getTranslation();
+  }
+
+ private:
+  static void CollectPlacements(G4LogicalVolume *pMother,
+                                const G4Transform3D &hMotherToWorld,
+                                const G4String &hPattern,
+                                vector<Placement> &hPlacements);
+};
+
+#endif
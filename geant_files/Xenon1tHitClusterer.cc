@@ -0,0 +1,183 @@
+// XENON Header Files
+#include "Xenon1tHitClusterer.hh"
+#include "Xenon1tHitClustererMessenger.hh"
+
+// Additional Header Files
+#include <cfloat>
+#include <cmath>
+
+// G4 Header Files
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tHitClusterer *Xenon1tHitClusterer::m_pInstance = 0;
+
+Xenon1tHitClusterer *Xenon1tHitClusterer::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tHitClusterer();
+  return m_pInstance;
+}
+
+Xenon1tHitClusterer::Xenon1tHitClusterer() {
+  m_bActive = false;
+  m_dDistanceR = 1. * mm;
+  m_dDistanceZ = 1. * mm;
+  m_dTimeWindow = 10. * ns;
+
+  m_dSteps = 0.;
+  m_dClusters = 0.;
+
+  m_pMessenger = new Xenon1tHitClustererMessenger(this);
+}
+
+Xenon1tHitClusterer::~Xenon1tHitClusterer() { delete m_pMessenger; }
+
+void Xenon1tHitClusterer::SetDistances(G4double dDistanceR,
+                                       G4double dDistanceZ) {
+  m_dDistanceR = dDistanceR;
+  m_dDistanceZ = dDistanceZ;
+}
+
+void Xenon1tHitClusterer::Clear() {
+  m_hClusters.clear();
+  m_hCells.clear();
+}
+
+unsigned long long Xenon1tHitClusterer::GetKey(G4int iVolume, long iX,
+                                               long iY, long iZ) {
+  // 20 bits per axis: cells further apart alias, but a step only joins a
+  // cluster it is near to, so aliasing never merges distant steps
+  const unsigned long long iMask = 0xfffffULL;
+  return ((unsigned long long)(iVolume & 0xf) << 60) |
+         (((unsigned long long)iX & iMask) << 40) |
+         (((unsigned long long)iY & iMask) << 20) |
+         ((unsigned long long)iZ & iMask);
+}
+
+unsigned long long Xenon1tHitClusterer::GetKey(
+    G4int iVolume, const G4ThreeVector &hPosition) const {
+  return GetKey(iVolume, (long)std::floor(hPosition.x() / m_dDistanceR),
+                (long)std::floor(hPosition.y() / m_dDistanceR),
+                (long)std::floor(hPosition.z() / m_dDistanceZ));
+}
+
+G4bool Xenon1tHitClusterer::IsNear(const Cluster &hCluster,
+                                   const G4ThreeVector &hPosition,
+                                   G4double dTime) const {
+  if (dTime - hCluster.dTime > m_dTimeWindow ||
+      hCluster.dTime - dTime > m_dTimeWindow)
+    return false;
+
+  const G4ThreeVector hDistance = hPosition - hCluster.GetPosition();
+  return std::fabs(hDistance.z()) <= m_dDistanceZ &&
+         hDistance.perp() <= m_dDistanceR;
+}
+
+void Xenon1tHitClusterer::RemoveFromCell(unsigned long long iKey,
+                                         G4int iCluster) {
+  unordered_map<unsigned long long, vector<G4int> >::iterator pCell =
+      m_hCells.find(iKey);
+  if (pCell == m_hCells.end()) return;
+
+  vector<G4int> &hIndices = pCell->second;
+  for (size_t i = 0; i < hIndices.size(); i++)
+    if (hIndices[i] == iCluster) {
+      hIndices[i] = hIndices.back();
+      hIndices.pop_back();
+      break;
+    }
+  if (hIndices.empty()) m_hCells.erase(pCell);
+}
+
+void Xenon1tHitClusterer::AddStep(G4int iVolume,
+                                  const G4ThreeVector &hPosition,
+                                  G4double dEnergy, G4double dTime,
+                                  G4int iTrackId, G4int iParentId,
+                                  const G4String &hParticleType,
+                                  const G4String &hCreatorProcess,
+                                  const G4String &hDepositingProcess) {
+  if (dEnergy <= 0.) return;
+  m_dSteps += 1.;
+
+  // any cluster within dr, dz has its position in one of the 27 cells
+  // around the step; the step joins the nearest one
+  const long iX = (long)std::floor(hPosition.x() / m_dDistanceR);
+  const long iY = (long)std::floor(hPosition.y() / m_dDistanceR);
+  const long iZ = (long)std::floor(hPosition.z() / m_dDistanceZ);
+  G4int iCluster = -1;
+  G4double dNearest = DBL_MAX;
+  for (long i = -1; i <= 1; i++)
+    for (long j = -1; j <= 1; j++)
+      for (long k = -1; k <= 1; k++) {
+        unordered_map<unsigned long long, vector<G4int> >::const_iterator
+            pCell = m_hCells.find(GetKey(iVolume, iX + i, iY + j, iZ + k));
+        if (pCell == m_hCells.end()) continue;
+
+        const vector<G4int> &hIndices = pCell->second;
+        for (size_t l = 0; l < hIndices.size(); l++) {
+          const Cluster &hCluster = m_hClusters[hIndices[l]];
+          if (hCluster.iVolume != iVolume ||
+              !IsNear(hCluster, hPosition, dTime))
+            continue;
+          const G4ThreeVector hDistance = hPosition - hCluster.GetPosition();
+          const G4double dDistance =
+              hDistance.perp2() / (m_dDistanceR * m_dDistanceR) +
+              hDistance.z() * hDistance.z() / (m_dDistanceZ * m_dDistanceZ);
+          if (dDistance < dNearest) {
+            dNearest = dDistance;
+            iCluster = hIndices[l];
+          }
+        }
+      }
+
+  if (iCluster < 0) {
+    Cluster hCluster;
+    hCluster.iVolume = iVolume;
+    hCluster.dEnergy = dEnergy;
+    hCluster.hWeightedPosition = dEnergy * hPosition;
+    hCluster.dTime = dTime;
+    hCluster.iSteps = 1;
+    hCluster.iTrackId = iTrackId;
+    hCluster.iParentId = iParentId;
+    hCluster.hParticleType = hParticleType;
+    hCluster.hCreatorProcess = hCreatorProcess;
+    hCluster.hDepositingProcess = hDepositingProcess;
+    m_hClusters.push_back(hCluster);
+    m_hCells[GetKey(iVolume, iX, iY, iZ)].push_back(
+        (G4int)m_hClusters.size() - 1);
+    m_dClusters += 1.;
+    return;
+  }
+
+  Cluster &hCluster = m_hClusters[iCluster];
+  const unsigned long long iOldKey =
+      GetKey(iVolume, hCluster.GetPosition());
+  hCluster.dEnergy += dEnergy;
+  hCluster.hWeightedPosition += dEnergy * hPosition;
+  if (dTime < hCluster.dTime) hCluster.dTime = dTime;
+  hCluster.iSteps++;
+
+  // a cluster whose position moved into another cell is found from there
+  const unsigned long long iNewKey =
+      GetKey(iVolume, hCluster.GetPosition());
+  if (iNewKey != iOldKey) {
+    RemoveFromCell(iOldKey, iCluster);
+    m_hCells[iNewKey].push_back(iCluster);
+  }
+}
+
+void Xenon1tHitClusterer::PrintSettings() const {
+  G4cout << "Xenon1tHitClusterer: " << (m_bActive ? "active" : "inactive")
+         << ", dr = " << m_dDistanceR / mm << " mm, dz = "
+         << m_dDistanceZ / mm << " mm, time window " << m_dTimeWindow / ns
+         << " ns" << G4endl;
+}
+
+void Xenon1tHitClusterer::PrintStatistics() const {
+  if (!m_bActive) return;
+  G4cout << "Xenon1tHitClusterer: " << m_dSteps << " steps in "
+         << m_dClusters << " clusters";
+  if (m_dClusters > 0.)
+    G4cout << " (" << m_dSteps / m_dClusters << " steps per hit)";
+  G4cout << G4endl;
+}
@@ -0,0 +1,102 @@
+#ifndef __XENON1THITCLUSTERER_H__
+#define __XENON1THITCLUSTERER_H__
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <unordered_map>
+#include <vector>
+
+using std::unordered_map;
+using std::vector;
+
+class Xenon1tHitClustererMessenger;
+
+// On-the-fly clustering of the LXe/GXe steps into interactions, so that the
+// sensitive detector writes one hit per cluster instead of one per step. A
+// step joins a cluster of the same volume whose energy-weighted position is
+// within dr (transverse) and dz of it and whose earliest time is within the
+// time window, otherwise it starts a new cluster. A cluster keeps the sum
+// of the energies, the energy-weighted position, the earliest time, the
+// number of steps and the track, particle and processes of its first step.
+//
+// The clusters are found through a hash of the (dr, dr, dz) grid, each cell
+// listing the clusters whose position is in it (a cluster moves to its new
+// cell when a step shifts its position): only the cells next to the step
+// are looked at, and a step joins the nearest of the clusters near it. The
+// defaults (1 mm, 10 ns) are well
+// below the scatter separation of nSort, which sees the same scatters from
+// far fewer hits.
+//
+// Hook-ups: Xenon1tLXeSensitiveDetector::Initialize() calls Clear(),
+// ProcessHits() calls AddStep() instead of making a hit when IsActive(),
+// and EndOfEvent() makes one Xenon1tLXeHit per GetCluster(i); the run
+// action calls PrintStatistics().
+
+class Xenon1tHitClusterer {
+ public:
+  static Xenon1tHitClusterer *GetInstance();
+  ~Xenon1tHitClusterer();
+
+  struct Cluster {
+    G4int iVolume;
+    G4double dEnergy;
+    G4ThreeVector hWeightedPosition;
+    G4double dTime;
+    G4int iSteps;
+    G4int iTrackId;
+    G4int iParentId;
+    G4String hParticleType;
+    G4String hCreatorProcess;
+    G4String hDepositingProcess;
+
+    G4ThreeVector GetPosition() const { return hWeightedPosition / dEnergy; }
+  };
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetDistances(G4double dDistanceR, G4double dDistanceZ);
+  void SetTimeWindow(G4double dTimeWindow) { m_dTimeWindow = dTimeWindow; }
+
+  void Clear();
+  // iVolume tells LXe from GXe (0-15)
+  void AddStep(G4int iVolume, const G4ThreeVector &hPosition,
+               G4double dEnergy, G4double dTime, G4int iTrackId,
+               G4int iParentId, const G4String &hParticleType,
+               const G4String &hCreatorProcess,
+               const G4String &hDepositingProcess);
+
+  G4int GetNumberOfClusters() const { return (G4int)m_hClusters.size(); }
+  const Cluster &GetCluster(G4int i) const { return m_hClusters[i]; }
+
+  void PrintSettings() const;
+  void PrintStatistics() const;
+
+ private:
+  Xenon1tHitClusterer();
+
+  static unsigned long long GetKey(G4int iVolume, long iX, long iY, long iZ);
+  unsigned long long GetKey(G4int iVolume,
+                            const G4ThreeVector &hPosition) const;
+  G4bool IsNear(const Cluster &hCluster, const G4ThreeVector &hPosition,
+                G4double dTime) const;
+  void RemoveFromCell(unsigned long long iKey, G4int iCluster);
+
+  static G4ThreadLocal Xenon1tHitClusterer *m_pInstance;
+
+  G4bool m_bActive;
+  G4double m_dDistanceR;
+  G4double m_dDistanceZ;
+  G4double m_dTimeWindow;
+
+  vector<Cluster> m_hClusters;
+  // grid cell -> clusters whose position is in it
+  unordered_map<unsigned long long, vector<G4int> > m_hCells;
+
+  G4double m_dSteps;
+  G4double m_dClusters;
+
+  Xenon1tHitClustererMessenger *m_pMessenger;
+};
+
+#endif
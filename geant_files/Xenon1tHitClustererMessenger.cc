@@ -0,0 +1,90 @@
+// XENON Header Files
+#include "Xenon1tHitClustererMessenger.hh"
+#include "Xenon1tHitClusterer.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tHitClustererMessenger::Xenon1tHitClustererMessenger(
+    Xenon1tHitClusterer *pClusterer)
+    : m_pClusterer(pClusterer) {
+  m_pClusterDir = new G4UIdirectory("/Xe/cluster/");
+  m_pClusterDir->SetGuidance("Cluster the LXe/GXe steps into hits.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/cluster/setActive", this);
+  m_pActiveCmd->SetGuidance("Write one hit per cluster instead of one per "
+                            "step.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pDistanceCmd = new G4UIcommand("/Xe/cluster/distance", this);
+  m_pDistanceCmd->SetGuidance("Largest transverse and vertical distance of "
+                              "a step to its cluster.");
+  m_pDistanceCmd->SetGuidance("[usage] /Xe/cluster/distance dr dz unit");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("dr", 'd', false);
+  pParameter->SetParameterRange("dr > 0.");
+  m_pDistanceCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("dz", 'd', false);
+  pParameter->SetParameterRange("dz > 0.");
+  m_pDistanceCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pDistanceCmd->SetParameter(pParameter);
+  m_pDistanceCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTimeWindowCmd =
+      new G4UIcmdWithADoubleAndUnit("/Xe/cluster/timeWindow", this);
+  m_pTimeWindowCmd->SetGuidance("Largest time of a step after (or before) "
+                                "the earliest one of its cluster.");
+  m_pTimeWindowCmd->SetParameterName("time", false);
+  m_pTimeWindowCmd->SetRange("time >= 0.");
+  m_pTimeWindowCmd->SetDefaultUnit("ns");
+  m_pTimeWindowCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/cluster/print", this);
+  m_pPrintCmd->SetGuidance("Print the settings and the steps per hit.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tHitClustererMessenger::~Xenon1tHitClustererMessenger() {
+  delete m_pActiveCmd;
+  delete m_pDistanceCmd;
+  delete m_pTimeWindowCmd;
+  delete m_pPrintCmd;
+  delete m_pClusterDir;
+}
+
+void Xenon1tHitClustererMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                               G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pClusterer->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pDistanceCmd) {
+    G4double dDistanceR, dDistanceZ;
+    G4String hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> dDistanceR >> dDistanceZ >> hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pClusterer->SetDistances(dDistanceR * dUnit, dDistanceZ * dUnit);
+  }
+
+  if (pUIcommand == m_pTimeWindowCmd)
+    m_pClusterer->SetTimeWindow(
+        m_pTimeWindowCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pPrintCmd) {
+    m_pClusterer->PrintSettings();
+    m_pClusterer->PrintStatistics();
+  }
+}
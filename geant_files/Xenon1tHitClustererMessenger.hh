@@ -0,0 +1,31 @@
+#ifndef __XENON1THITCLUSTERERMESSENGER_H__
+#define __XENON1THITCLUSTERERMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tHitClusterer;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tHitClustererMessenger : public G4UImessenger {
+ public:
+  Xenon1tHitClustererMessenger(Xenon1tHitClusterer *pClusterer);
+  ~Xenon1tHitClustererMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tHitClusterer *m_pClusterer;
+
+  G4UIdirectory *m_pClusterDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pDistanceCmd;
+  G4UIcmdWithADoubleAndUnit *m_pTimeWindowCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
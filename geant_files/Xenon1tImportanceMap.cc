@@ -0,0 +1,96 @@
+// XENON Header Files
+#include "Xenon1tImportanceMap.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tImportanceMapMessenger.hh"
+
+// G4 Header Files
+#include <G4GeometryCell.hh>
+#include <G4IStore.hh>
+#include <G4LogicalVolume.hh>
+#include <G4VPhysicalVolume.hh>
+
+Xenon1tImportanceMap *Xenon1tImportanceMap::m_pInstance = 0;
+
+Xenon1tImportanceMap *Xenon1tImportanceMap::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tImportanceMap();
+  return m_pInstance;
+}
+
+Xenon1tImportanceMap::Xenon1tImportanceMap() {
+  m_bActive = false;
+
+  m_pMessenger = new Xenon1tImportanceMapMessenger(this);
+}
+
+Xenon1tImportanceMap::~Xenon1tImportanceMap() { delete m_pMessenger; }
+
+void Xenon1tImportanceMap::SetImportance(const G4String &hVolume,
+                                         G4double dImportance) {
+  if (dImportance <= 0.)
+    G4Exception("Xenon1tImportanceMap::SetImportance()", "ImportanceMap",
+                FatalException, "Importances must be positive");
+
+  for (size_t i = 0; i < m_hVolumes.size(); i++)
+    if (m_hVolumes[i] == hVolume) {
+      m_hImportances[i] = dImportance;
+      return;
+    }
+  m_hVolumes.push_back(hVolume);
+  m_hImportances.push_back(dImportance);
+}
+
+void Xenon1tImportanceMap::ClearImportances() {
+  m_hVolumes.clear();
+  m_hImportances.clear();
+}
+
+G4double Xenon1tImportanceMap::GetImportance(const G4String &hVolume,
+                                             G4double dMotherImportance) const {
+  for (size_t i = 0; i < m_hVolumes.size(); i++)
+    if (Xenon1tGeometryUtilities::MatchName(m_hVolumes[i], hVolume))
+      return m_hImportances[i];
+  return dMotherImportance;
+}
+
+void Xenon1tImportanceMap::ApplyImportances(G4VPhysicalVolume *pWorld) {
+  if (!m_bActive) return;
+
+  const G4int iCells = AddCells(pWorld, 1.);
+
+  G4cout << "Xenon1tImportanceMap: " << iCells
+         << " geometry cells in G4IStore" << G4endl;
+  PrintImportances();
+}
+
+G4bool Xenon1tImportanceMap::IsApplied(G4VPhysicalVolume *pWorld) const {
+  return G4IStore::GetInstance()->IsKnown(G4GeometryCell(*pWorld, 0));
+}
+
+G4int Xenon1tImportanceMap::AddCells(G4VPhysicalVolume *pVolume,
+                                     G4double dMotherImportance) {
+  G4IStore *pStore = G4IStore::GetInstance();
+  const G4double dImportance =
+      GetImportance(pVolume->GetName(), dMotherImportance);
+
+  // replicas and parameterised volumes get one cell per copy number
+  G4int iCells = 0;
+  G4int iCopies = pVolume->GetMultiplicity();
+  for (G4int iCopy = 0; iCopy < iCopies; iCopy++) {
+    // a volume placed in several mothers keeps its first importance
+    if (pStore->IsKnown(G4GeometryCell(*pVolume, iCopy))) continue;
+    pStore->AddImportanceGeometryCell(dImportance, *pVolume, iCopy);
+    iCells++;
+  }
+
+  G4LogicalVolume *pLogicalVolume = pVolume->GetLogicalVolume();
+  for (G4int i = 0; i < pLogicalVolume->GetNoDaughters(); i++)
+    iCells += AddCells(pLogicalVolume->GetDaughter(i), dImportance);
+  return iCells;
+}
+
+void Xenon1tImportanceMap::PrintImportances() const {
+  G4cout << "Xenon1tImportanceMap: " << (m_bActive ? "on" : "off")
+         << ", unlisted volumes inherit from their mother" << G4endl;
+  for (size_t i = 0; i < m_hVolumes.size(); i++)
+    G4cout << "  " << m_hVolumes[i] << ": " << m_hImportances[i] << G4endl;
+}
@@ -0,0 +1,68 @@
+#ifndef __XENON1TIMPORTANCEMAP_H__
+#define __XENON1TIMPORTANCEMAP_H__
+
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tImportanceMapMessenger;
+class G4VPhysicalVolume;
+
+// Importance map over the physical volumes for geometry splitting and
+// Russian roulette (G4ImportanceProcess). A track crossing from importance
+// I1 into I2 > I1 is split into I2/I1 copies of weight w I1/I2; moving to a
+// lower importance it survives with probability I2/I1 and weight w I1/I2.
+//
+// Importances are declared per volume name (trailing '*' wildcard) from the
+// macro; every volume that is not listed inherits the importance of its
+// mother, the world has importance 1. ApplyImportances() fills G4IStore and
+// is called at the end of the geometry construction.
+//
+// One instance shared by all threads: the importances are set on the master
+// in PreInit and only read by the workers, which fill their own G4IStore
+// from ConstructSDandField().
+//
+// The physics list has to register G4ImportanceBiasing with a
+// G4GeometrySampler on the mass world for the biased particles, e.g.
+//
+//   G4GeometrySampler hSampler(pWorld, "gamma");
+//   pPhysicsList->RegisterPhysics(new G4ImportanceBiasing(&hSampler));
+//
+// and the hits must store the track weight.
+
+class Xenon1tImportanceMap {
+ public:
+  static Xenon1tImportanceMap *GetInstance();
+  ~Xenon1tImportanceMap();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void SetImportance(const G4String &hVolume, G4double dImportance);
+  void ClearImportances();
+
+  // fills the G4IStore of the calling thread
+  void ApplyImportances(G4VPhysicalVolume *pWorld);
+  G4bool IsApplied(G4VPhysicalVolume *pWorld) const;
+
+  void PrintImportances() const;
+
+ private:
+  Xenon1tImportanceMap();
+
+  G4double GetImportance(const G4String &hVolume,
+                         G4double dMotherImportance) const;
+  G4int AddCells(G4VPhysicalVolume *pVolume, G4double dMotherImportance);
+
+  static Xenon1tImportanceMap *m_pInstance;
+
+  G4bool m_bActive;
+  vector<G4String> m_hVolumes;
+  vector<G4double> m_hImportances;
+
+  Xenon1tImportanceMapMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,76 @@
+// XENON Header Files
+#include "Xenon1tImportanceMapMessenger.hh"
+#include "Xenon1tImportanceMap.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tImportanceMapMessenger::Xenon1tImportanceMapMessenger(
+    Xenon1tImportanceMap *pImportanceMap)
+    : m_pImportanceMap(pImportanceMap) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pImportanceDir = new G4UIdirectory("/Xe/importance/", false);
+  m_pImportanceDir->SetGuidance("Geometry importance biasing (splitting and "
+                                "Russian roulette).");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/importance/setActive", this);
+  m_pActiveCmd->SetGuidance("Fill G4IStore from the importance map when the "
+                            "geometry is built.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit);
+
+  m_pSetCmd = new G4UIcommand("/Xe/importance/set", this);
+  m_pSetCmd->SetGuidance("Importance of a physical volume (trailing * "
+                         "matches a prefix).");
+  m_pSetCmd->SetGuidance("Unlisted volumes inherit from their mother.");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("volume", 's', false);
+  m_pSetCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("importance", 'd', false);
+  pParameter->SetParameterRange("importance > 0.");
+  m_pSetCmd->SetParameter(pParameter);
+  m_pSetCmd->AvailableForStates(G4State_PreInit);
+
+  m_pClearCmd = new G4UIcmdWithoutParameter("/Xe/importance/clear", this);
+  m_pClearCmd->SetGuidance("Remove all importances.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/importance/print", this);
+  m_pPrintCmd->SetGuidance("Print the importance map.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tImportanceMapMessenger::~Xenon1tImportanceMapMessenger() {
+  delete m_pActiveCmd;
+  delete m_pSetCmd;
+  delete m_pClearCmd;
+  delete m_pPrintCmd;
+  delete m_pImportanceDir;
+}
+
+void Xenon1tImportanceMapMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pImportanceMap->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pSetCmd) {
+    G4String hVolume;
+    G4double dImportance;
+    istringstream hStream(hNewValue);
+    hStream >> hVolume >> dImportance;
+    m_pImportanceMap->SetImportance(hVolume, dImportance);
+  }
+
+  if (pUIcommand == m_pClearCmd) m_pImportanceMap->ClearImportances();
+
+  if (pUIcommand == m_pPrintCmd) m_pImportanceMap->PrintImportances();
+}
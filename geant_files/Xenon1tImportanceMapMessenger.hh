@@ -0,0 +1,30 @@
+#ifndef __XENON1TIMPORTANCEMAPMESSENGER_H__
+#define __XENON1TIMPORTANCEMAPMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tImportanceMap;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tImportanceMapMessenger : public G4UImessenger {
+ public:
+  Xenon1tImportanceMapMessenger(Xenon1tImportanceMap *pImportanceMap);
+  ~Xenon1tImportanceMapMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tImportanceMap *m_pImportanceMap;
+
+  G4UIdirectory *m_pImportanceDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pSetCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
@@ -0,0 +1,244 @@
+// XENON Header Files
+#include "Xenon1tKillZones.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tKillZonesMessenger.hh"
+
+// Additional Header Files
+#include <cmath>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4EventManager.hh>
+#include <G4LogicalVolume.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4Region.hh>
+#include <G4Step.hh>
+#include <G4StepPoint.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+// upper edges of the energy decades of the tallies, the last one is open
+static const G4double g_dEnergyEdges[] = {10. * keV, 100. * keV, 1. * MeV,
+                                          10. * MeV};
+
+G4ThreadLocal Xenon1tKillZones *Xenon1tKillZones::m_pInstance = 0;
+
+Xenon1tKillZones *Xenon1tKillZones::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tKillZones();
+  return m_pInstance;
+}
+
+Xenon1tKillZones::Xenon1tKillZones() {
+  m_bActive = false;
+  AddVolume("Lab");
+  AddVolume("Concrete");
+  AddVolume("Rock");
+  m_dRMax = 0.;
+  m_dZMin = 0.;
+  m_dZMax = 0.;
+  m_iAuditInterval = 0;
+
+  m_iEventId = -1;
+  m_bAuditEvent = false;
+  m_bReturned = false;
+
+  m_dAuditEvents = 0.;
+  m_dReturnedEvents = 0.;
+  m_dReturnedEnergy = 0.;
+
+  m_pMessenger = new Xenon1tKillZonesMessenger(this);
+}
+
+Xenon1tKillZones::~Xenon1tKillZones() { delete m_pMessenger; }
+
+void Xenon1tKillZones::AddVolume(const G4String &hVolume) {
+  Zone hZone = {hVolume, false};
+  m_hZones.push_back(hZone);
+}
+
+void Xenon1tKillZones::AddRegion(const G4String &hRegion) {
+  Zone hZone = {hRegion, true};
+  m_hZones.push_back(hZone);
+}
+
+void Xenon1tKillZones::SetBoundary(G4double dRMax, G4double dZMin,
+                                   G4double dZMax) {
+  m_dRMax = dRMax;
+  m_dZMin = dZMin;
+  m_dZMax = dZMax;
+}
+
+void Xenon1tKillZones::BeginEvent(G4int iEventId) {
+  m_iEventId = iEventId;
+  m_bAuditEvent = m_iAuditInterval > 0 && iEventId % m_iAuditInterval == 0;
+  m_bReturned = false;
+  m_hFlagged.clear();
+  if (m_bAuditEvent) m_dAuditEvents += 1.;
+}
+
+G4int Xenon1tKillZones::FindZone(const G4StepPoint *pPoint) const {
+  const G4VPhysicalVolume *pVolume = pPoint->GetPhysicalVolume();
+  if (!pVolume) return -1;
+
+  for (size_t i = 0; i < m_hZones.size(); i++) {
+    const Zone &hZone = m_hZones[i];
+    if (hZone.bRegion) {
+      const G4Region *pRegion = pVolume->GetLogicalVolume()->GetRegion();
+      if (pRegion && pRegion->GetName() == hZone.hName) return (G4int)i;
+    } else if (Xenon1tGeometryUtilities::MatchName(hZone.hName,
+                                                   pVolume->GetName()))
+      return (G4int)i;
+  }
+  return -1;
+}
+
+G4bool Xenon1tKillZones::IsInside(const G4StepPoint *pPoint) const {
+  const G4ThreeVector &hPosition = pPoint->GetPosition();
+  return hPosition.perp() <= m_dRMax && hPosition.z() >= m_dZMin &&
+         hPosition.z() <= m_dZMax;
+}
+
+G4bool Xenon1tKillZones::IsOutward(const G4StepPoint *pPoint) const {
+  const G4ThreeVector &hPosition = pPoint->GetPosition();
+  const G4ThreeVector &hDirection = pPoint->GetMomentumDirection();
+  if (hPosition.perp() > m_dRMax &&
+      hPosition.x() * hDirection.x() + hPosition.y() * hDirection.y() > 0.)
+    return true;
+  return (hPosition.z() > m_dZMax && hDirection.z() > 0.) ||
+         (hPosition.z() < m_dZMin && hDirection.z() < 0.);
+}
+
+void Xenon1tKillZones::ProcessStep(const G4Step *pStep) {
+  if (!m_bActive) return;
+
+  const G4Event *pEvent =
+      G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  if (pEvent->GetEventID() != m_iEventId) BeginEvent(pEvent->GetEventID());
+
+  // only the steps that enter a zone or cross the boundary
+  const G4StepPoint *pPreStepPoint = pStep->GetPreStepPoint();
+  const G4StepPoint *pPostStepPoint = pStep->GetPostStepPoint();
+  G4String hZone;
+  if (pPostStepPoint->GetStepStatus() == fGeomBoundary) {
+    const G4int iZone = FindZone(pPostStepPoint);
+    if (iZone >= 0 && FindZone(pPreStepPoint) < 0)
+      hZone = m_hZones[iZone].hName;
+  }
+  if (hZone.empty() && m_dRMax > 0. && IsInside(pPreStepPoint) &&
+      !IsInside(pPostStepPoint) && IsOutward(pPostStepPoint))
+    hZone = "boundary";
+
+  if (m_bAuditEvent) {
+    Audit(pStep, !hZone.empty());
+    return;
+  }
+  if (hZone.empty()) return;
+
+  AddToTally(hZone, pStep->GetTrack());
+  pStep->GetTrack()->SetTrackStatus(fStopAndKill);
+}
+
+void Xenon1tKillZones::AddToTally(const G4String &hZone,
+                                  const G4Track *pTrack) {
+  const G4String &hParticle = pTrack->GetDefinition()->GetParticleName();
+  Tally *pTally = 0;
+  for (size_t i = 0; i < m_hTallies.size() && !pTally; i++)
+    if (m_hTallies[i].hZone == hZone && m_hTallies[i].hParticle == hParticle)
+      pTally = &m_hTallies[i];
+  if (!pTally) {
+    Tally hTally;
+    hTally.hZone = hZone;
+    hTally.hParticle = hParticle;
+    for (G4int j = 0; j < m_iEnergyBins; j++) hTally.dTracks[j] = 0.;
+    hTally.dEnergy = 0.;
+    m_hTallies.push_back(hTally);
+    pTally = &m_hTallies.back();
+  }
+
+  const G4double dEnergy = pTrack->GetKineticEnergy();
+  G4int iBin = 0;
+  while (iBin < m_iEnergyBins - 1 && dEnergy >= g_dEnergyEdges[iBin]) iBin++;
+  pTally->dTracks[iBin] += 1.;
+  pTally->dEnergy += dEnergy;
+}
+
+void Xenon1tKillZones::Audit(const G4Step *pStep, G4bool bEntered) {
+  const G4Track *pTrack = pStep->GetTrack();
+  const G4StepPoint *pPreStepPoint = pStep->GetPreStepPoint();
+  const G4double dTime = pPreStepPoint->GetGlobalTime();
+
+  // secondaries made after their parent entered a zone are flagged too
+  if (pTrack->GetCurrentStepNumber() == 1) {
+    map<G4int, G4double>::const_iterator pParent =
+        m_hFlagged.find(pTrack->GetParentID());
+    if (pParent != m_hFlagged.end() && dTime >= pParent->second)
+      m_hFlagged[pTrack->GetTrackID()] = dTime;
+  }
+  if (bEntered && !m_hFlagged.count(pTrack->GetTrackID()))
+    m_hFlagged[pTrack->GetTrackID()] =
+        pStep->GetPostStepPoint()->GetGlobalTime();
+
+  const G4double dEnergy = pStep->GetTotalEnergyDeposit();
+  if (dEnergy <= 0.) return;
+  map<G4int, G4double>::const_iterator pFlagged =
+      m_hFlagged.find(pTrack->GetTrackID());
+  if (pFlagged == m_hFlagged.end() || dTime < pFlagged->second) return;
+
+  const G4VPhysicalVolume *pVolume = pPreStepPoint->GetPhysicalVolume();
+  if (!pVolume) return;
+  const G4String &hVolume = pVolume->GetName();
+  if (hVolume != "LXe" && hVolume != "GXe") return;
+
+  if (!m_bReturned) {
+    m_bReturned = true;
+    m_dReturnedEvents += 1.;
+  }
+  m_dReturnedEnergy += dEnergy;
+}
+
+void Xenon1tKillZones::PrintSettings() const {
+  G4cout << "Xenon1tKillZones: " << (m_bActive ? "active" : "inactive")
+         << ", zones";
+  for (size_t i = 0; i < m_hZones.size(); i++)
+    G4cout << " " << (m_hZones[i].bRegion ? "region " : "")
+           << m_hZones[i].hName;
+  if (m_dRMax > 0.)
+    G4cout << ", outward beyond r = " << m_dRMax / mm << " mm, "
+           << m_dZMin / mm << " < z < " << m_dZMax / mm << " mm";
+  if (m_iAuditInterval > 0)
+    G4cout << ", audit every " << m_iAuditInterval << " events";
+  G4cout << G4endl;
+}
+
+void Xenon1tKillZones::PrintStatistics() const {
+  if (!m_bActive) return;
+  G4cout << "Xenon1tKillZones: killed tracks per zone and particle (< 10 "
+         << "keV, < 100 keV, < 1 MeV, < 10 MeV, above)" << G4endl;
+  for (size_t i = 0; i < m_hTallies.size(); i++) {
+    const Tally &hTally = m_hTallies[i];
+    G4double dTracks = 0.;
+    for (G4int j = 0; j < m_iEnergyBins; j++) dTracks += hTally.dTracks[j];
+    G4cout << "  " << hTally.hZone << " " << hTally.hParticle << ": "
+           << dTracks << " tracks (";
+    for (G4int j = 0; j < m_iEnergyBins; j++)
+      G4cout << (j ? " " : "") << hTally.dTracks[j];
+    G4cout << "), " << hTally.dEnergy / MeV << " MeV" << G4endl;
+  }
+
+  if (m_dAuditEvents <= 0.) return;
+  // 2.3 events is the 90% CL upper limit when none came back
+  const G4double dFraction = m_dReturnedEvents / m_dAuditEvents;
+  const G4double dError = (m_dReturnedEvents > 0.)
+                              ? std::sqrt(m_dReturnedEvents) / m_dAuditEvents
+                              : 2.3 / m_dAuditEvents;
+  G4cout << "  audit: " << m_dReturnedEvents << " of " << m_dAuditEvents
+         << " events with " << m_dReturnedEnergy / keV
+         << " keV in the xenon after entering a kill zone, ignored fraction "
+         << (m_dReturnedEvents > 0. ? "" : "< ")
+         << (m_dReturnedEvents > 0. ? dFraction : dError);
+  if (m_dReturnedEvents > 0.) G4cout << " +- " << dError;
+  G4cout << G4endl;
+}
@@ -0,0 +1,108 @@
+#ifndef __XENON1TKILLZONES_H__
+#define __XENON1TKILLZONES_H__
+
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+class Xenon1tKillZonesMessenger;
+class G4Step;
+class G4StepPoint;
+class G4Track;
+
+// Kill zones for tracks leaving the shield toward the laboratory. A track
+// is stopped when it enters a zone, i.e. a physical volume ("*" wildcards)
+// or a region of Xenon1tRegions, or when it crosses the boundary cylinder
+// (/Xe/killZone/boundary, world frame, off by default) moving outward.
+// Tracks born inside a zone are left alone. The defaults are the volumes
+// of ConstructLaboratory() around the water tank: Lab, Concrete, Rock.
+// Every killed track is counted per zone, particle and energy decade.
+//
+// What is ignored is the backscatter of the killed tracks into the xenon.
+// A photon scattered back from the concrete carries at most ~255 keV
+// (Compton at 180 deg) and has to cross the tank wall and metres of water
+// to reach the cryostat; water attenuates 100-500 keV photons by about
+// e^-10 per metre, so even with a build-up factor of 100 the return is
+// negligible next to the components inside the tank. Electrons and
+// neutrons never come back in practice for ER runs. The estimate can be
+// checked in the run itself: with /Xe/killZone/auditEvery N every N-th
+// event is simulated without killing, the tracks entering a zone (and
+// their later secondaries) are flagged, and their deposits in LXe/GXe are
+// summed. The fraction of audited events with such a deposit is printed;
+// it is the fraction of killed-mode events that miss a deposit.
+//
+// Hook-ups: Xenon1tSteppingAction::UserSteppingAction() calls
+// ProcessStep(pStep), Xenon1tRunAction::EndOfRunAction() calls
+// PrintStatistics().
+
+class Xenon1tKillZones {
+ public:
+  static Xenon1tKillZones *GetInstance();
+  ~Xenon1tKillZones();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void AddVolume(const G4String &hVolume);
+  void AddRegion(const G4String &hRegion);
+  void ClearZones() { m_hZones.clear(); }
+  void SetBoundary(G4double dRMax, G4double dZMin, G4double dZMax);
+  void SetAuditInterval(G4int iAuditInterval) {
+    m_iAuditInterval = iAuditInterval;
+  }
+
+  void ProcessStep(const G4Step *pStep);
+
+  void PrintSettings() const;
+  void PrintStatistics() const;
+
+ private:
+  Xenon1tKillZones();
+
+  struct Zone {
+    G4String hName;
+    G4bool bRegion;
+  };
+
+  static const G4int m_iEnergyBins = 5;
+
+  struct Tally {
+    G4String hZone;
+    G4String hParticle;
+    G4double dTracks[m_iEnergyBins];
+    G4double dEnergy;
+  };
+
+  void BeginEvent(G4int iEventId);
+  G4int FindZone(const G4StepPoint *pPoint) const;
+  G4bool IsInside(const G4StepPoint *pPoint) const;
+  G4bool IsOutward(const G4StepPoint *pPoint) const;
+  void AddToTally(const G4String &hZone, const G4Track *pTrack);
+  void Audit(const G4Step *pStep, G4bool bEntered);
+
+  static G4ThreadLocal Xenon1tKillZones *m_pInstance;
+
+  G4bool m_bActive;
+  vector<Zone> m_hZones;
+  G4double m_dRMax, m_dZMin, m_dZMax;
+  G4int m_iAuditInterval;
+
+  G4int m_iEventId;
+  G4bool m_bAuditEvent;
+  G4bool m_bReturned;
+  // flagged tracks of the audited event and the time they were flagged at
+  map<G4int, G4double> m_hFlagged;
+
+  vector<Tally> m_hTallies;
+  G4double m_dAuditEvents;
+  G4double m_dReturnedEvents;
+  G4double m_dReturnedEnergy;
+
+  Xenon1tKillZonesMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,115 @@
+// XENON Header Files
+#include "Xenon1tKillZonesMessenger.hh"
+#include "Xenon1tKillZones.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tKillZonesMessenger::Xenon1tKillZonesMessenger(
+    Xenon1tKillZones *pKillZones)
+    : m_pKillZones(pKillZones) {
+  m_pKillZoneDir = new G4UIdirectory("/Xe/killZone/");
+  m_pKillZoneDir->SetGuidance("Stop tracks leaving the shield toward the "
+                              "laboratory.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/killZone/setActive", this);
+  m_pActiveCmd->SetGuidance("Kill the tracks entering a zone.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pVolumeCmd = new G4UIcmdWithAString("/Xe/killZone/volume", this);
+  m_pVolumeCmd->SetGuidance("Add a physical volume (\"*\" wildcards) to the "
+                            "zones.");
+  m_pVolumeCmd->SetParameterName("volume", false);
+  m_pVolumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pRegionCmd = new G4UIcmdWithAString("/Xe/killZone/region", this);
+  m_pRegionCmd->SetGuidance("Add a region (/Xe/regions/) to the zones.");
+  m_pRegionCmd->SetParameterName("region", false);
+  m_pRegionCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd = new G4UIcmdWithoutParameter("/Xe/killZone/clear", this);
+  m_pClearCmd->SetGuidance("Remove all zones, also the default ones.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pBoundaryCmd = new G4UIcommand("/Xe/killZone/boundary", this);
+  m_pBoundaryCmd->SetGuidance("Kill tracks crossing this cylinder outward "
+                              "(world frame), rmax 0 for none.");
+  m_pBoundaryCmd->SetGuidance("[usage] /Xe/killZone/boundary rmax zmin zmax "
+                              "unit");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("rmax", 'd', false);
+  pParameter->SetParameterRange("rmax >= 0.");
+  m_pBoundaryCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmin", 'd', false);
+  m_pBoundaryCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmax", 'd', false);
+  m_pBoundaryCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pBoundaryCmd->SetParameter(pParameter);
+  m_pBoundaryCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pAuditCmd = new G4UIcmdWithAnInteger("/Xe/killZone/auditEvery", this);
+  m_pAuditCmd->SetGuidance("Simulate every N-th event without killing and "
+                           "sum the xenon deposits of the tracks that");
+  m_pAuditCmd->SetGuidance("entered a zone (0 for none).");
+  m_pAuditCmd->SetParameterName("events", false);
+  m_pAuditCmd->SetRange("events >= 0");
+  m_pAuditCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/killZone/print", this);
+  m_pPrintCmd->SetGuidance("Print the zones and the killed track tallies.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tKillZonesMessenger::~Xenon1tKillZonesMessenger() {
+  delete m_pActiveCmd;
+  delete m_pVolumeCmd;
+  delete m_pRegionCmd;
+  delete m_pClearCmd;
+  delete m_pBoundaryCmd;
+  delete m_pAuditCmd;
+  delete m_pPrintCmd;
+  delete m_pKillZoneDir;
+}
+
+void Xenon1tKillZonesMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                            G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pKillZones->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pVolumeCmd) m_pKillZones->AddVolume(hNewValue);
+
+  if (pUIcommand == m_pRegionCmd) m_pKillZones->AddRegion(hNewValue);
+
+  if (pUIcommand == m_pClearCmd) m_pKillZones->ClearZones();
+
+  if (pUIcommand == m_pBoundaryCmd) {
+    G4double dRMax, dZMin, dZMax;
+    G4String hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> dRMax >> dZMin >> dZMax >> hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pKillZones->SetBoundary(dRMax * dUnit, dZMin * dUnit, dZMax * dUnit);
+  }
+
+  if (pUIcommand == m_pAuditCmd)
+    m_pKillZones->SetAuditInterval(m_pAuditCmd->GetNewIntValue(hNewValue));
+
+  if (pUIcommand == m_pPrintCmd) {
+    m_pKillZones->PrintSettings();
+    m_pKillZones->PrintStatistics();
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef __XENON1TKILLZONESMESSENGER_H__
+#define __XENON1TKILLZONESMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tKillZones;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tKillZonesMessenger : public G4UImessenger {
+ public:
+  Xenon1tKillZonesMessenger(Xenon1tKillZones *pKillZones);
+  ~Xenon1tKillZonesMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tKillZones *m_pKillZones;
+
+  G4UIdirectory *m_pKillZoneDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pVolumeCmd;
+  G4UIcmdWithAString *m_pRegionCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcommand *m_pBoundaryCmd;
+  G4UIcmdWithAnInteger *m_pAuditCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
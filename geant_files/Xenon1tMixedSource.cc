@@ -0,0 +1,189 @@
+// XENON Header Files
+#include "Xenon1tMixedSource.hh"
+#include "Xenon1tDecayGenerator.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tEventTime.hh"
+#include "Xenon1tMixedSourceMessenger.hh"
+#include "Xenon1tVolumeSampler.hh"
+
+// Additional Header Files
+#include <fstream>
+#include <sstream>
+
+using std::ifstream;
+using std::istringstream;
+
+// G4 Header Files
+#include <G4Event.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tMixedSource::Xenon1tMixedSource() {
+  m_hTableDirectory = "decay_tables";
+  m_bSamplingReady = false;
+
+  m_pMessenger = new Xenon1tMixedSourceMessenger(this);
+}
+
+Xenon1tMixedSource::~Xenon1tMixedSource() {
+  Clear();
+  delete m_pMessenger;
+}
+
+void Xenon1tMixedSource::Clear() {
+  for (size_t i = 0; i < m_hComponents.size(); i++)
+    delete m_hComponents[i].pSampler;
+  m_hComponents.clear();
+  m_hSources.clear();
+
+  for (map<G4String, Xenon1tDecayGenerator *>::iterator pIt =
+           m_hGenerators.begin();
+       pIt != m_hGenerators.end(); ++pIt)
+    delete pIt->second;
+  m_hGenerators.clear();
+
+  m_bSamplingReady = false;
+}
+
+void Xenon1tMixedSource::SetTable(const G4String &hFileName) {
+  Clear();
+  m_hFileName = hFileName;
+  if (m_hFileName != "None") ReadTable();
+}
+
+void Xenon1tMixedSource::ReadTable() {
+  ifstream hFile(m_hFileName.c_str());
+  if (!hFile.is_open())
+    G4Exception("Xenon1tMixedSource::ReadTable()", "MixedSource",
+                FatalException,
+                ("Cannot open contamination table " + m_hFileName).c_str());
+
+  std::string hLine;
+  G4int iLine = 0;
+  while (std::getline(hFile, hLine)) {
+    iLine++;
+    const size_t iComment = hLine.find('#');
+    if (iComment != std::string::npos) hLine.erase(iComment);
+
+    istringstream hStream(hLine);
+    G4String hKey;
+    if (!(hStream >> hKey)) continue;
+
+    if (hKey == "component") {
+      G4String hVolume, hSubRegion;
+      G4double dMass = 0.;
+      hStream >> hVolume >> hSubRegion >> dMass;
+      if (dMass <= 0.) {
+        G4cerr << "Xenon1tMixedSource: " << m_hFileName << ":" << iLine
+               << " component without mass" << G4endl;
+        continue;
+      }
+      Component hComponent;
+      hComponent.hName = (hSubRegion == "-") ? hVolume : hSubRegion;
+      hComponent.dMass = dMass * kg;
+      hComponent.pSampler = new Xenon1tVolumeSampler(
+          hVolume, (hSubRegion == "-") ? G4String("") : hSubRegion);
+      m_hComponents.push_back(hComponent);
+      continue;
+    }
+
+    // isotope line: <segment> <activity in mBq/kg>
+    G4double dActivity = 0.;
+    if (!(hStream >> dActivity) || m_hComponents.empty()) {
+      G4cerr << "Xenon1tMixedSource: " << m_hFileName << ":" << iLine
+             << " activity without component" << G4endl;
+      continue;
+    }
+    if (dActivity <= 0.) continue;
+
+    Source hSource;
+    hSource.iComponent = (G4int)m_hComponents.size() - 1;
+    hSource.hIsotope = hKey;
+    hSource.dActivity = dActivity * 1e-3 * becquerel / kg;
+    hSource.dRate = 0.;
+    m_hSources.push_back(hSource);
+  }
+
+  if (m_hSources.empty())
+    G4Exception("Xenon1tMixedSource::ReadTable()", "MixedSource",
+                FatalException, ("No sources in " + m_hFileName).c_str());
+}
+
+Xenon1tDecayGenerator *Xenon1tMixedSource::GetGenerator(
+    const G4String &hIsotope) {
+  map<G4String, Xenon1tDecayGenerator *>::iterator pIt =
+      m_hGenerators.find(hIsotope);
+  if (pIt != m_hGenerators.end()) return pIt->second;
+
+  Xenon1tDecayGenerator *pGenerator = new Xenon1tDecayGenerator(false);
+  pGenerator->SetTableDirectory(m_hTableDirectory);
+  pGenerator->SetSegment(hIsotope);
+  m_hGenerators[hIsotope] = pGenerator;
+  return pGenerator;
+}
+
+void Xenon1tMixedSource::BuildSampling() {
+  vector<G4double> hRates;
+  for (size_t i = 0; i < m_hSources.size(); i++) {
+    Source &hSource = m_hSources[i];
+    hSource.dRate = m_hComponents[hSource.iComponent].dMass *
+                    hSource.dActivity *
+                    GetGenerator(hSource.hIsotope)->GetDecaysPerParentDecay();
+    hRates.push_back(hSource.dRate);
+  }
+  m_hAliasTable.Build(hRates);
+  Xenon1tEventTime::GetInstance()->SetSourceRate(
+      m_hAliasTable.GetTotalWeight());
+  m_bSamplingReady = true;
+
+  PrintSources();
+}
+
+G4double Xenon1tMixedSource::GetTotalRate() {
+  if (!m_bSamplingReady) BuildSampling();
+  return m_hAliasTable.GetTotalWeight();
+}
+
+void Xenon1tMixedSource::GeneratePrimaryVertex(G4Event *pEvent) {
+  if (m_hSources.empty()) {
+    G4Exception("Xenon1tMixedSource::GeneratePrimaryVertex()", "MixedSource",
+                FatalException,
+                "No contamination table, use /xe/gun/mixed/table");
+    return;
+  }
+  if (!m_bSamplingReady) BuildSampling();
+
+  // the stream of the event before the choice of its source
+  Xenon1tEventRandom::GetInstance()->BeginEvent(pEvent);
+
+  const Source &hSource = m_hSources[m_hAliasTable.Sample()];
+  const Component &hComponent = m_hComponents[hSource.iComponent];
+  Xenon1tDecayGenerator *pGenerator = GetGenerator(hSource.hIsotope);
+
+  pGenerator->SetParticlePosition(hComponent.pSampler->SamplePosition(pEvent));
+  pGenerator->SetParticleTime(particle_time);
+  pGenerator->GeneratePrimaryVertex(pEvent);
+
+  // the chain weight counts decays per parent decay, here every event is
+  // already one decay
+  const G4double dScale = 1. / pGenerator->GetDecaysPerParentDecay();
+  Xenon1tEventInformation *pInformation =
+      Xenon1tEventInformation::GetOrCreate(pEvent);
+  pInformation->MultiplyWeight(dScale);
+  pInformation->SetComponent(hComponent.hName);
+  pInformation->SetIsotope(hSource.hIsotope);
+}
+
+void Xenon1tMixedSource::PrintSources() {
+  const G4double dTotalRate = GetTotalRate();
+  G4cout << "Xenon1tMixedSource: " << m_hFileName << " - "
+         << m_hComponents.size() << " components, " << m_hSources.size()
+         << " sources, " << dTotalRate * s << " decays/s" << G4endl;
+  for (size_t i = 0; i < m_hSources.size(); i++)
+    G4cout << "  " << m_hComponents[m_hSources[i].iComponent].hName << " "
+           << m_hSources[i].hIsotope << ": " << m_hSources[i].dRate * s
+           << " decays/s (" << 100. * m_hSources[i].dRate / dTotalRate
+           << "% of the events)" << G4endl;
+}
@@ -0,0 +1,82 @@
+#ifndef __XENON1TMIXEDSOURCE_H__
+#define __XENON1TMIXEDSOURCE_H__
+
+#include "Xenon1tAliasTable.hh"
+
+#include <G4VPrimaryGenerator.hh>
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+class Xenon1tDecayGenerator;
+class Xenon1tMixedSourceMessenger;
+class Xenon1tVolumeSampler;
+class G4Event;
+
+// Physically weighted background stream: every event is one decay of one
+// (component, isotope) pair, drawn in proportion to its decay rate
+//
+//   R = mass * activity * (decays of the chain per decay of its parent)
+//
+// from a contamination table (see contamination_tables/README), so that N
+// events are N / R_total seconds of detector live time, with unit weights
+// (times the weights of the biasing options). The vertex is uniform in the
+// component, or in one of its sub-regions, the decay products come from the
+// decay tables, and component and isotope are stored in the
+// Xenon1tEventInformation of the event.
+
+class Xenon1tMixedSource : public G4VPrimaryGenerator {
+ public:
+  Xenon1tMixedSource();
+  ~Xenon1tMixedSource();
+
+  void GeneratePrimaryVertex(G4Event *pEvent);
+
+  void SetTable(const G4String &hFileName);
+  void SetTableDirectory(const G4String &hDirectory) {
+    m_hTableDirectory = hDirectory;
+  }
+
+  G4bool IsActive() const { return !m_hSources.empty(); }
+  // decays per second of the whole detector
+  G4double GetTotalRate();
+
+  void PrintSources();
+
+ private:
+  struct Source {
+    G4int iComponent;
+    G4String hIsotope;
+    G4double dActivity;
+    G4double dRate;
+  };
+
+  struct Component {
+    G4String hName;
+    G4double dMass;
+    Xenon1tVolumeSampler *pSampler;
+  };
+
+  void ReadTable();
+  void BuildSampling();
+  Xenon1tDecayGenerator *GetGenerator(const G4String &hIsotope);
+  void Clear();
+
+  G4String m_hFileName;
+  G4String m_hTableDirectory;
+
+  vector<Component> m_hComponents;
+  vector<Source> m_hSources;
+  map<G4String, Xenon1tDecayGenerator *> m_hGenerators;
+
+  G4bool m_bSamplingReady;
+  Xenon1tAliasTable m_hAliasTable;
+
+  Xenon1tMixedSourceMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,49 @@
+// XENON Header Files
+#include "Xenon1tMixedSourceMessenger.hh"
+#include "Xenon1tMixedSource.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tMixedSourceMessenger::Xenon1tMixedSourceMessenger(
+    Xenon1tMixedSource *pMixedSource)
+    : m_pMixedSource(pMixedSource) {
+  m_pMixedDir = new G4UIdirectory("/xe/gun/mixed/");
+  m_pMixedDir->SetGuidance("Activity-weighted mixed-component source.");
+
+  m_pDirectoryCmd = new G4UIcmdWithAString("/xe/gun/mixed/directory", this);
+  m_pDirectoryCmd->SetGuidance("Directory holding the decay tables.");
+  m_pDirectoryCmd->SetParameterName("directory", false);
+  m_pDirectoryCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTableCmd = new G4UIcmdWithAString("/xe/gun/mixed/table", this);
+  m_pTableCmd->SetGuidance("Contamination table (components, masses and "
+                           "activities), None switches the source off.");
+  m_pTableCmd->SetParameterName("table", false);
+  m_pTableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/xe/gun/mixed/print", this);
+  m_pPrintCmd->SetGuidance("Print the decay rates and the total rate, the "
+                           "live time of a run is N / rate.");
+  m_pPrintCmd->AvailableForStates(G4State_Idle);
+}
+
+Xenon1tMixedSourceMessenger::~Xenon1tMixedSourceMessenger() {
+  delete m_pDirectoryCmd;
+  delete m_pTableCmd;
+  delete m_pPrintCmd;
+  delete m_pMixedDir;
+}
+
+void Xenon1tMixedSourceMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                              G4String hNewValue) {
+  if (pUIcommand == m_pDirectoryCmd)
+    m_pMixedSource->SetTableDirectory(hNewValue);
+
+  if (pUIcommand == m_pTableCmd) m_pMixedSource->SetTable(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) m_pMixedSource->PrintSources();
+}
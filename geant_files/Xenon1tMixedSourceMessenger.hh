@@ -0,0 +1,29 @@
+#ifndef __XENON1TMIXEDSOURCEMESSENGER_H__
+#define __XENON1TMIXEDSOURCEMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tMixedSource;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tMixedSourceMessenger : public G4UImessenger {
+ public:
+  Xenon1tMixedSourceMessenger(Xenon1tMixedSource *pMixedSource);
+  ~Xenon1tMixedSourceMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tMixedSource *m_pMixedSource;
+
+  G4UIdirectory *m_pMixedDir;
+  G4UIcmdWithAString *m_pDirectoryCmd;
+  G4UIcmdWithAString *m_pTableCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
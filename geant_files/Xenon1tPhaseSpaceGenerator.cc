@@ -0,0 +1,166 @@
+// XENON Header Files
+#include "Xenon1tPhaseSpaceGenerator.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tEventRandom.hh"
+#include "Xenon1tForkRunner.hh"
+#include "Xenon1tPhaseSpaceGeneratorMessenger.hh"
+
+// Additional Header Files
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using std::ifstream;
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4IonTable.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4PrimaryParticle.hh>
+#include <G4PrimaryVertex.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4PhysicalConstants.hh>
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tPhaseSpaceGenerator::Xenon1tPhaseSpaceGenerator() {
+  m_iResampling = 1;
+  m_bRandomRotation = false;
+  m_iStageOneEvents = 0;
+
+  m_pMessenger = new Xenon1tPhaseSpaceGeneratorMessenger(this);
+}
+
+Xenon1tPhaseSpaceGenerator::~Xenon1tPhaseSpaceGenerator() {
+  delete m_pMessenger;
+}
+
+void Xenon1tPhaseSpaceGenerator::SetFileName(const G4String &hFileName) {
+  m_hFileName = hFileName;
+  m_hRecords.clear();
+  m_hEventOffsets.clear();
+  m_hEventWeights.clear();
+  if (m_hFileName != "None") ReadFile();
+}
+
+void Xenon1tPhaseSpaceGenerator::ReadFile() {
+  ifstream hFile(m_hFileName.c_str(), std::ios::in | std::ios::binary);
+  if (!hFile.is_open())
+    G4Exception("Xenon1tPhaseSpaceGenerator::ReadFile()", "PhaseSpace",
+                FatalException, ("Cannot open " + m_hFileName).c_str());
+
+  char hMagic[8];
+  G4int iVersion = 0;
+  hFile.read(hMagic, 8);
+  hFile.read(reinterpret_cast<char *>(&iVersion), sizeof(G4int));
+  hFile.read(reinterpret_cast<char *>(&m_iStageOneEvents), sizeof(G4int));
+  if (!hFile || std::memcmp(hMagic, Xenon1tPhaseSpaceRecorder::m_hMagic, 8) ||
+      iVersion != Xenon1tPhaseSpaceRecorder::m_iVersion)
+    G4Exception("Xenon1tPhaseSpaceGenerator::ReadFile()", "PhaseSpace",
+                FatalException,
+                (m_hFileName + " is not a phase-space file").c_str());
+
+  Xenon1tPhaseSpaceRecord hRecord;
+  while (hFile.read(reinterpret_cast<char *>(&hRecord), sizeof(hRecord))) {
+    if (m_hRecords.empty() || hRecord.iEventId != m_hRecords.back().iEventId) {
+      m_hEventOffsets.push_back((G4int)m_hRecords.size());
+      m_hEventWeights.push_back(hRecord.dEventWeight);
+    } else if (std::fabs(hRecord.dEventWeight - m_hEventWeights.back()) >
+               1e-9 * std::fabs(m_hEventWeights.back())) {
+      std::ostringstream hMessage;
+      hMessage << "Records of stage-one event " << hRecord.iEventId
+               << " in " << m_hFileName << " have different event weights ("
+               << m_hEventWeights.back() << ", " << hRecord.dEventWeight
+               << ")";
+      G4Exception("Xenon1tPhaseSpaceGenerator::ReadFile()", "PhaseSpace",
+                  FatalException, hMessage.str().c_str());
+    }
+    m_hRecords.push_back(hRecord);
+  }
+  m_hEventOffsets.push_back((G4int)m_hRecords.size());
+
+  if (m_hRecords.empty())
+    G4Exception("Xenon1tPhaseSpaceGenerator::ReadFile()", "PhaseSpace",
+                FatalException, ("No records in " + m_hFileName).c_str());
+  if (m_iStageOneEvents == 0)
+    G4Exception("Xenon1tPhaseSpaceGenerator::ReadFile()", "PhaseSpace",
+                JustWarning,
+                "Stage one was not closed, number of events unknown");
+
+  G4cout << "Xenon1tPhaseSpaceGenerator: " << m_hFileName << " - "
+         << m_hRecords.size() << " records, " << m_hEventOffsets.size() - 1
+         << " events with a crossing out of " << m_iStageOneEvents
+         << " stage-one events" << G4endl;
+}
+
+void Xenon1tPhaseSpaceGenerator::GeneratePrimaryVertex(G4Event *pEvent) {
+  if (m_hRecords.empty()) {
+    G4Exception("Xenon1tPhaseSpaceGenerator::GeneratePrimaryVertex()",
+                "PhaseSpace", FatalException,
+                "No phase-space file, use /xe/gun/phasespace/file");
+    return;
+  }
+
+  // event ids are unique across the threads of a run and restart at 0 in
+  // every forked worker
+  const G4long iReplay = Xenon1tEventRandom::GetInstance()->GetFirstEvent() +
+                         Xenon1tForkRunner::GetInstance()->GetFirstEvent() +
+                         pEvent->GetEventID();
+  if (iReplay >= GetNumberOfReplayEvents()) {
+    std::ostringstream hMessage;
+    hMessage << "Replay " << iReplay << " past the end of " << m_hFileName
+             << " (" << GetNumberOfReplayEvents()
+             << " replays), run fewer events or raise the resampling";
+    G4Exception("Xenon1tPhaseSpaceGenerator::GeneratePrimaryVertex()",
+                "PhaseSpace", FatalException, hMessage.str().c_str());
+    return;
+  }
+  const G4int iEvent = (G4int)(iReplay / m_iResampling);
+
+  const G4double dPhi = m_bRandomRotation ? twopi * G4UniformRand() : 0.;
+  G4ParticleTable *pParticleTable = G4ParticleTable::GetParticleTable();
+
+  for (G4int i = m_hEventOffsets[iEvent]; i < m_hEventOffsets[iEvent + 1];
+       i++) {
+    const Xenon1tPhaseSpaceRecord &hRecord = m_hRecords[i];
+
+    G4ParticleDefinition *pDefinition =
+        pParticleTable->FindParticle(hRecord.iPdgCode);
+    if (!pDefinition)
+      pDefinition = G4IonTable::GetIonTable()->GetIon(hRecord.iPdgCode);
+    if (!pDefinition) {
+      G4cerr << "Xenon1tPhaseSpaceGenerator: unknown PDG code "
+             << hRecord.iPdgCode << G4endl;
+      continue;
+    }
+
+    G4ThreeVector hPosition(hRecord.fPosition[0], hRecord.fPosition[1],
+                            hRecord.fPosition[2]);
+    G4ThreeVector hDirection(hRecord.fDirection[0], hRecord.fDirection[1],
+                             hRecord.fDirection[2]);
+    hPosition *= mm;
+    hPosition.rotateZ(dPhi);
+    hDirection = hDirection.unit().rotateZ(dPhi);
+
+    // the 1/N of the resampling goes on the event only
+    G4PrimaryVertex *pVertex =
+        new G4PrimaryVertex(hPosition, hRecord.fTime * ns);
+    pVertex->SetWeight(hRecord.dWeight);
+
+    const G4double dEnergy = hRecord.fEnergy * keV;
+    const G4double dMass = pDefinition->GetPDGMass();
+    G4PrimaryParticle *pParticle = new G4PrimaryParticle(pDefinition);
+    pParticle->SetMomentum(hDirection *
+                           std::sqrt(dEnergy * (dEnergy + 2. * dMass)));
+    pVertex->SetPrimary(pParticle);
+
+    pEvent->AddPrimaryVertex(pVertex);
+  }
+
+  // the stage-one event weight, checked to be the same in all its records
+  Xenon1tEventInformation::GetOrCreate(pEvent)->MultiplyWeight(
+      m_hEventWeights[iEvent] / m_iResampling);
+}
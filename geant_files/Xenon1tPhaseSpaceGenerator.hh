@@ -0,0 +1,67 @@
+#ifndef __XENON1TPHASESPACEGENERATOR_H__
+#define __XENON1TPHASESPACEGENERATOR_H__
+
+#include "Xenon1tPhaseSpaceRecorder.hh"
+
+#include <G4VPrimaryGenerator.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tPhaseSpaceGeneratorMessenger;
+class G4Event;
+
+// Stage two of the surface source: replays the particles written by
+// Xenon1tPhaseSpaceRecorder, one stage-one event per G4 event, so that the
+// inner part of the detector can be rerun for many variants.
+//
+// With resampling N every stage-one event is replayed N times: the event
+// weight is the stage-one event weight over N, the vertices keep the
+// weights of their tracks (transport biasing of stage one). The replays
+// differ through the random stream of the transport and, optionally,
+// through a random rotation about the z axis (the inner cryostat and the
+// TPC are cylindrically symmetric to a good approximation).
+// The weighted count divided by GetNumberOfStageOneEvents() is the rate per
+// primary of stage one.
+//
+// Replay i is the global event number, first event of the shard
+// (XE_FIRST_EVENT or /Xe/random/firstEvent, plus the first event of a
+// forked worker) + event id, so that threads, forked workers and array
+// tasks replay disjoint parts of the file. A shard that runs past the end
+// of the file is a fatal error: the replays would no longer be independent.
+
+class Xenon1tPhaseSpaceGenerator : public G4VPrimaryGenerator {
+ public:
+  Xenon1tPhaseSpaceGenerator();
+  ~Xenon1tPhaseSpaceGenerator();
+
+  void GeneratePrimaryVertex(G4Event *pEvent);
+
+  void SetFileName(const G4String &hFileName);
+  void SetResampling(G4int iResampling) { m_iResampling = iResampling; }
+  void SetRandomRotation(G4bool bRotation) { m_bRandomRotation = bRotation; }
+
+  G4bool IsActive() const { return !m_hRecords.empty(); }
+  G4int GetNumberOfStageOneEvents() const { return m_iStageOneEvents; }
+  G4long GetNumberOfReplayEvents() const {
+    return ((G4long)m_hEventOffsets.size() - 1) * m_iResampling;
+  }
+
+ private:
+  void ReadFile();
+
+  G4String m_hFileName;
+  G4int m_iResampling;
+  G4bool m_bRandomRotation;
+
+  G4int m_iStageOneEvents;
+  vector<Xenon1tPhaseSpaceRecord> m_hRecords;
+  vector<G4int> m_hEventOffsets;
+  vector<G4double> m_hEventWeights;
+
+  Xenon1tPhaseSpaceGeneratorMessenger *m_pMessenger;
+};
+
+#endif
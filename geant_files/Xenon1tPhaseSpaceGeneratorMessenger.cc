@@ -0,0 +1,58 @@
+// XENON Header Files
+#include "Xenon1tPhaseSpaceGeneratorMessenger.hh"
+#include "Xenon1tPhaseSpaceGenerator.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tPhaseSpaceGeneratorMessenger::Xenon1tPhaseSpaceGeneratorMessenger(
+    Xenon1tPhaseSpaceGenerator *pGenerator)
+    : m_pGenerator(pGenerator) {
+  m_pPhaseSpaceDir = new G4UIdirectory("/xe/gun/phasespace/");
+  m_pPhaseSpaceDir->SetGuidance("Phase-space replay (surface source, stage "
+                                "two).");
+
+  m_pFileCmd = new G4UIcmdWithAString("/xe/gun/phasespace/file", this);
+  m_pFileCmd->SetGuidance("Phase-space file written by /Xe/phasespace/. "
+                          "Replaces the particle source.");
+  m_pFileCmd->SetGuidance("None goes back to the particle source.");
+  m_pFileCmd->SetParameterName("file", false);
+  m_pFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pResamplingCmd =
+      new G4UIcmdWithAnInteger("/xe/gun/phasespace/resample", this);
+  m_pResamplingCmd->SetGuidance("Replay every stage-one event N times with "
+                                "weight w/N.");
+  m_pResamplingCmd->SetParameterName("N", false);
+  m_pResamplingCmd->SetRange("N >= 1");
+  m_pResamplingCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pRotationCmd =
+      new G4UIcmdWithABool("/xe/gun/phasespace/randomRotation", this);
+  m_pRotationCmd->SetGuidance("Rotate every replay by a random angle about "
+                              "the z axis.");
+  m_pRotationCmd->SetParameterName("rotation", false);
+  m_pRotationCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tPhaseSpaceGeneratorMessenger::~Xenon1tPhaseSpaceGeneratorMessenger() {
+  delete m_pFileCmd;
+  delete m_pResamplingCmd;
+  delete m_pRotationCmd;
+  delete m_pPhaseSpaceDir;
+}
+
+void Xenon1tPhaseSpaceGeneratorMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                      G4String hNewValue) {
+  if (pUIcommand == m_pFileCmd) m_pGenerator->SetFileName(hNewValue);
+
+  if (pUIcommand == m_pResamplingCmd)
+    m_pGenerator->SetResampling(m_pResamplingCmd->GetNewIntValue(hNewValue));
+
+  if (pUIcommand == m_pRotationCmd)
+    m_pGenerator->SetRandomRotation(m_pRotationCmd->GetNewBoolValue(hNewValue));
+}
@@ -0,0 +1,30 @@
+#ifndef __XENON1TPHASESPACEGENERATORMESSENGER_H__
+#define __XENON1TPHASESPACEGENERATORMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tPhaseSpaceGenerator;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+
+class Xenon1tPhaseSpaceGeneratorMessenger : public G4UImessenger {
+ public:
+  Xenon1tPhaseSpaceGeneratorMessenger(Xenon1tPhaseSpaceGenerator *pGenerator);
+  ~Xenon1tPhaseSpaceGeneratorMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tPhaseSpaceGenerator *m_pGenerator;
+
+  G4UIdirectory *m_pPhaseSpaceDir;
+  G4UIcmdWithAString *m_pFileCmd;
+  G4UIcmdWithAnInteger *m_pResamplingCmd;
+  G4UIcmdWithABool *m_pRotationCmd;
+};
+
+#endif
@@ -0,0 +1,167 @@
+// XENON Header Files
+#include "Xenon1tPhaseSpaceRecorder.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tPhaseSpaceRecorderMessenger.hh"
+#include "Xenon1tThreadOutput.hh"
+
+// Additional Header Files
+#include <cstring>
+#include <unistd.h>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4EventManager.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4Step.hh>
+#include <G4StepPoint.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tPhaseSpaceRecorder
+    *Xenon1tPhaseSpaceRecorder::m_pInstance = 0;
+
+const char *Xenon1tPhaseSpaceRecorder::m_hMagic = "XEPHSP\0";
+const G4int Xenon1tPhaseSpaceRecorder::m_iVersion;
+
+Xenon1tPhaseSpaceRecorder *Xenon1tPhaseSpaceRecorder::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tPhaseSpaceRecorder();
+  return m_pInstance;
+}
+
+Xenon1tPhaseSpaceRecorder::Xenon1tPhaseSpaceRecorder() {
+  m_bActive = false;
+  m_hFileName = "phasespace.bin";
+  m_hVolume = "SS_InnerCryostat";
+  m_iNumberOfRecords = 0;
+  m_iResumedEvents = 0;
+
+  m_pMessenger = new Xenon1tPhaseSpaceRecorderMessenger(this);
+}
+
+Xenon1tPhaseSpaceRecorder::~Xenon1tPhaseSpaceRecorder() {
+  if (m_hFile.is_open()) m_hFile.close();
+  delete m_pMessenger;
+}
+
+void Xenon1tPhaseSpaceRecorder::SetFileName(const G4String &hFileName) {
+  if (m_hFile.is_open())
+    G4Exception("Xenon1tPhaseSpaceRecorder::SetFileName()", "PhaseSpace",
+                JustWarning, "File already open, name change ignored");
+  else
+    m_hFileName = hFileName;
+}
+
+void Xenon1tPhaseSpaceRecorder::Open() {
+  // one file per worker thread in MT runs
+  const G4String hFileName = Xenon1tThreadOutput::GetFileName(m_hFileName);
+  m_hFile.open(hFileName.c_str(), std::ios::out | std::ios::binary);
+  if (!m_hFile.is_open())
+    G4Exception("Xenon1tPhaseSpaceRecorder::Open()", "PhaseSpace",
+                FatalException, ("Cannot open " + hFileName).c_str());
+
+  // the number of events is filled in by Close()
+  char hMagic[8];
+  std::memcpy(hMagic, m_hMagic, 8);
+  const G4int iEvents = 0;
+  m_hFile.write(hMagic, 8);
+  m_hFile.write(reinterpret_cast<const char *>(&m_iVersion), sizeof(G4int));
+  m_hFile.write(reinterpret_cast<const char *>(&iEvents), sizeof(G4int));
+  m_iNumberOfRecords = 0;
+
+  G4cout << "Xenon1tPhaseSpaceRecorder: recording tracks entering "
+         << m_hVolume << " to " << hFileName << G4endl;
+}
+
+G4bool Xenon1tPhaseSpaceRecorder::Process(const G4Step *pStep) {
+  if (!m_bActive) return false;
+
+  const G4StepPoint *pPostStepPoint = pStep->GetPostStepPoint();
+  if (pPostStepPoint->GetStepStatus() != fGeomBoundary) return false;
+
+  const G4VPhysicalVolume *pPostVolume = pPostStepPoint->GetPhysicalVolume();
+  if (!pPostVolume ||
+      !Xenon1tGeometryUtilities::MatchName(m_hVolume, pPostVolume->GetName()))
+    return false;
+
+  const G4VPhysicalVolume *pPreVolume =
+      pStep->GetPreStepPoint()->GetPhysicalVolume();
+  if (Xenon1tGeometryUtilities::MatchName(m_hVolume, pPreVolume->GetName()))
+    return false;
+
+  if (!m_hFile.is_open()) Open();
+
+  G4Track *pTrack = pStep->GetTrack();
+
+  const G4Event *pEvent =
+      G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  const Xenon1tEventInformation *pInformation =
+      dynamic_cast<const Xenon1tEventInformation *>(
+          pEvent->GetUserInformation());
+
+  Xenon1tPhaseSpaceRecord hRecord;
+  hRecord.iEventId = m_iResumedEvents + pEvent->GetEventID();
+  hRecord.iPdgCode = pTrack->GetDefinition()->GetPDGEncoding();
+  const G4ThreeVector &hPosition = pPostStepPoint->GetPosition();
+  const G4ThreeVector &hDirection = pPostStepPoint->GetMomentumDirection();
+  for (G4int i = 0; i < 3; i++) {
+    hRecord.fPosition[i] = hPosition[i] / mm;
+    hRecord.fDirection[i] = hDirection[i];
+  }
+  hRecord.fEnergy = pPostStepPoint->GetKineticEnergy() / keV;
+  hRecord.fTime = pPostStepPoint->GetGlobalTime() / ns;
+  hRecord.dWeight = pTrack->GetWeight();
+  hRecord.dEventWeight = pInformation ? pInformation->GetWeight() : 1.;
+
+  m_hFile.write(reinterpret_cast<const char *>(&hRecord), sizeof(hRecord));
+  m_iNumberOfRecords++;
+
+  // the rest of its history is simulated by the replay
+  pTrack->SetTrackStatus(fStopAndKill);
+  return true;
+}
+
+void Xenon1tPhaseSpaceRecorder::Close(G4int iNumberOfEvents) {
+  if (!m_hFile.is_open()) return;
+
+  iNumberOfEvents += m_iResumedEvents;
+  m_hFile.seekp(8 + sizeof(G4int));
+  m_hFile.write(reinterpret_cast<const char *>(&iNumberOfEvents),
+                sizeof(G4int));
+  m_hFile.close();
+
+  G4cout << "Xenon1tPhaseSpaceRecorder: " << m_iNumberOfRecords
+         << " records from " << iNumberOfEvents << " events written to "
+         << m_hFileName << G4endl;
+}
+
+long Xenon1tPhaseSpaceRecorder::Flush() {
+  if (!m_hFile.is_open()) return 0;
+  m_hFile.flush();
+  return (long)m_hFile.tellp();
+}
+
+void Xenon1tPhaseSpaceRecorder::Resume(long iSize, G4int iRecords,
+                                       G4int iEvents) {
+  m_iResumedEvents = iEvents;
+  if (!m_bActive || iSize <= 0) return;
+
+  // records after the checkpoint belong to events that are simulated again
+  const G4String hFileName = Xenon1tThreadOutput::GetFileName(m_hFileName);
+  if (truncate(hFileName.c_str(), iSize) != 0)
+    G4Exception("Xenon1tPhaseSpaceRecorder::Resume()", "PhaseSpace",
+                FatalException, ("Cannot resume " + hFileName).c_str());
+  m_hFile.open(hFileName.c_str(),
+               std::ios::in | std::ios::out | std::ios::binary);
+  if (!m_hFile.is_open())
+    G4Exception("Xenon1tPhaseSpaceRecorder::Resume()", "PhaseSpace",
+                FatalException, ("Cannot open " + hFileName).c_str());
+  m_hFile.seekp(0, std::ios::end);
+  m_iNumberOfRecords = iRecords;
+
+  G4cout << "Xenon1tPhaseSpaceRecorder: resuming " << hFileName << " after "
+         << iRecords << " records" << G4endl;
+}
@@ -0,0 +1,80 @@
+#ifndef __XENON1TPHASESPACERECORDER_H__
+#define __XENON1TPHASESPACERECORDER_H__
+
+#include <globals.hh>
+
+#include <fstream>
+
+using std::ofstream;
+
+class Xenon1tPhaseSpaceRecorderMessenger;
+class G4Step;
+
+// One particle crossing the recording surface, 56 bytes on disk. Positions
+// in mm (world frame), energy in keV, time in ns. Records of the same
+// stage-one event are written consecutively and replayed together. dWeight
+// is the weight of the track, dEventWeight the weight of its stage-one
+// event (Xenon1tEventInformation), the same in all records of the event.
+struct Xenon1tPhaseSpaceRecord {
+  G4int iEventId;
+  G4int iPdgCode;
+  float fPosition[3];
+  float fDirection[3];
+  float fEnergy;
+  float fTime;
+  double dWeight;
+  double dEventWeight;
+};
+
+// Stage one of the two-stage surface source: every track entering the
+// recording volume (default SS_InnerCryostat) is written to a binary
+// phase-space file and killed, so that the transport through the outer
+// components is done only once. The file header stores the number of
+// stage-one events, needed to normalise the replayed rates.
+//
+// The stepping action calls Process() for every step and the run action
+// calls Close() at the end of the run.
+
+class Xenon1tPhaseSpaceRecorder {
+ public:
+  static Xenon1tPhaseSpaceRecorder *GetInstance();
+  ~Xenon1tPhaseSpaceRecorder();
+
+  static const char *m_hMagic;
+  static const G4int m_iVersion = 2;
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetFileName(const G4String &hFileName);
+  void SetVolume(const G4String &hVolume) { m_hVolume = hVolume; }
+
+  // returns true if the track was recorded (and killed)
+  G4bool Process(const G4Step *pStep);
+
+  void Close(G4int iNumberOfEvents);
+
+  // checkpoints (Xenon1tCheckpoint): Flush() returns the size of the file
+  // written so far, Resume() cuts the file back to that size and continues
+  // it, after iEvents events of the interrupted job
+  long Flush();
+  G4int GetNumberOfRecords() const { return m_iNumberOfRecords; }
+  void Resume(long iSize, G4int iRecords, G4int iEvents);
+
+ private:
+  Xenon1tPhaseSpaceRecorder();
+
+  void Open();
+
+  static G4ThreadLocal Xenon1tPhaseSpaceRecorder *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hFileName;
+  G4String m_hVolume;
+  ofstream m_hFile;
+  G4int m_iNumberOfRecords;
+  G4int m_iResumedEvents;
+
+  Xenon1tPhaseSpaceRecorderMessenger *m_pMessenger;
+};
+
+#endif
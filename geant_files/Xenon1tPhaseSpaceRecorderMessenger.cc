@@ -0,0 +1,51 @@
+// XENON Header Files
+#include "Xenon1tPhaseSpaceRecorderMessenger.hh"
+#include "Xenon1tPhaseSpaceRecorder.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tPhaseSpaceRecorderMessenger::Xenon1tPhaseSpaceRecorderMessenger(
+    Xenon1tPhaseSpaceRecorder *pRecorder)
+    : m_pRecorder(pRecorder) {
+  m_pPhaseSpaceDir = new G4UIdirectory("/Xe/phasespace/");
+  m_pPhaseSpaceDir->SetGuidance("Phase-space recording (surface source, "
+                                "stage one).");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/phasespace/setActive", this);
+  m_pActiveCmd->SetGuidance("Record and kill the tracks entering the "
+                            "recording volume.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pFileCmd = new G4UIcmdWithAString("/Xe/phasespace/file", this);
+  m_pFileCmd->SetGuidance("Output phase-space file.");
+  m_pFileCmd->SetParameterName("file", false);
+  m_pFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pVolumeCmd = new G4UIcmdWithAString("/Xe/phasespace/volume", this);
+  m_pVolumeCmd->SetGuidance("Physical volume whose entrance surface is "
+                            "recorded (SS_InnerCryostat).");
+  m_pVolumeCmd->SetParameterName("volume", false);
+  m_pVolumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tPhaseSpaceRecorderMessenger::~Xenon1tPhaseSpaceRecorderMessenger() {
+  delete m_pActiveCmd;
+  delete m_pFileCmd;
+  delete m_pVolumeCmd;
+  delete m_pPhaseSpaceDir;
+}
+
+void Xenon1tPhaseSpaceRecorderMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                     G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pRecorder->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pFileCmd) m_pRecorder->SetFileName(hNewValue);
+
+  if (pUIcommand == m_pVolumeCmd) m_pRecorder->SetVolume(hNewValue);
+}
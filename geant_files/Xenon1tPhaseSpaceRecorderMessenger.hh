@@ -0,0 +1,29 @@
+#ifndef __XENON1TPHASESPACERECORDERMESSENGER_H__
+#define __XENON1TPHASESPACERECORDERMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tPhaseSpaceRecorder;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+
+class Xenon1tPhaseSpaceRecorderMessenger : public G4UImessenger {
+ public:
+  Xenon1tPhaseSpaceRecorderMessenger(Xenon1tPhaseSpaceRecorder *pRecorder);
+  ~Xenon1tPhaseSpaceRecorderMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tPhaseSpaceRecorder *m_pRecorder;
+
+  G4UIdirectory *m_pPhaseSpaceDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pFileCmd;
+  G4UIcmdWithAString *m_pVolumeCmd;
+};
+
+#endif
@@ -0,0 +1,133 @@
+// XENON Header Files
+#include "Xenon1tPhiloxEngine.hh"
+
+// Additional Header Files
+#include <fstream>
+
+using std::ifstream;
+using std::ofstream;
+
+namespace {
+const unsigned int iM0 = 0xD2511F53u, iM1 = 0xCD9E8D57u;
+const unsigned int iW0 = 0x9E3779B9u, iW1 = 0xBB67AE85u;
+
+inline void MultiplyHiLo(unsigned int a, unsigned int b, unsigned int &iHi,
+                         unsigned int &iLo) {
+  const unsigned long long iProduct = (unsigned long long)a * b;
+  iHi = (unsigned int)(iProduct >> 32);
+  iLo = (unsigned int)iProduct;
+}
+}
+
+Xenon1tPhiloxEngine::Xenon1tPhiloxEngine() { SetStream(0, 0); }
+
+Xenon1tPhiloxEngine::~Xenon1tPhiloxEngine() { ; }
+
+void Xenon1tPhiloxEngine::SetStream(unsigned long long iKey,
+                                    unsigned long long iEvent) {
+  m_iKey[0] = (unsigned int)iKey;
+  m_iKey[1] = (unsigned int)(iKey >> 32);
+  m_iCounter[0] = 0;
+  m_iCounter[1] = 0;
+  m_iCounter[2] = (unsigned int)iEvent;
+  m_iCounter[3] = (unsigned int)(iEvent >> 32);
+  m_iWord = 4;
+}
+
+void Xenon1tPhiloxEngine::NextBlock() {
+  unsigned int x[4] = {m_iCounter[0], m_iCounter[1], m_iCounter[2],
+                       m_iCounter[3]};
+  unsigned int k[2] = {m_iKey[0], m_iKey[1]};
+  for (int iRound = 0; iRound < 10; iRound++) {
+    unsigned int iHi0, iLo0, iHi1, iLo1;
+    MultiplyHiLo(iM0, x[0], iHi0, iLo0);
+    MultiplyHiLo(iM1, x[2], iHi1, iLo1);
+    const unsigned int y[4] = {iHi1 ^ x[1] ^ k[0], iLo1, iHi0 ^ x[3] ^ k[1],
+                               iLo0};
+    x[0] = y[0];
+    x[1] = y[1];
+    x[2] = y[2];
+    x[3] = y[3];
+    k[0] += iW0;
+    k[1] += iW1;
+  }
+  for (int i = 0; i < 4; i++) m_iBlock[i] = x[i];
+
+  // the draw counter of the event, 64 bits
+  if (++m_iCounter[0] == 0) ++m_iCounter[1];
+  m_iWord = 0;
+}
+
+double Xenon1tPhiloxEngine::flat() {
+  if (m_iWord > 2) NextBlock();
+  const unsigned int a = m_iBlock[m_iWord] >> 5;
+  const unsigned int b = m_iBlock[m_iWord + 1] >> 6;
+  m_iWord += 2;
+
+  // 53 bits, centre of the cell: never exactly 0 or 1
+  return (a * 67108864. + b + 0.5) / 9007199254740992.;
+}
+
+void Xenon1tPhiloxEngine::flatArray(const int iSize, double *pVector) {
+  for (int i = 0; i < iSize; i++) pVector[i] = flat();
+}
+
+Xenon1tPhiloxEngine::operator unsigned int() {
+  if (m_iWord > 3) NextBlock();
+  return m_iBlock[m_iWord++];
+}
+
+void Xenon1tPhiloxEngine::setSeed(long iSeed, int) {
+  SetStream((unsigned long)iSeed, 0);
+}
+
+void Xenon1tPhiloxEngine::setSeeds(const long *pSeeds, int) {
+  if (!pSeeds || !pSeeds[0]) return;
+  unsigned long long iKey = (unsigned long)pSeeds[0];
+  if (pSeeds[1]) iKey = (iKey << 32) ^ (unsigned long)pSeeds[1];
+  SetStream(iKey, 0);
+}
+
+void Xenon1tPhiloxEngine::saveStatus(const char szFileName[]) const {
+  ofstream hFile(szFileName);
+  put(hFile);
+}
+
+void Xenon1tPhiloxEngine::restoreStatus(const char szFileName[]) {
+  ifstream hFile(szFileName);
+  if (hFile.is_open()) get(hFile);
+}
+
+void Xenon1tPhiloxEngine::showStatus() const {
+  std::cout << "Xenon1tPhiloxEngine: key = " << m_iKey[1] << " " << m_iKey[0]
+            << ", counter = " << m_iCounter[3] << " " << m_iCounter[2] << " "
+            << m_iCounter[1] << " " << m_iCounter[0] << ", word = " << m_iWord
+            << std::endl;
+}
+
+std::ostream &Xenon1tPhiloxEngine::put(std::ostream &hOut) const {
+  hOut << name() << "\n";
+  hOut << m_iKey[0] << " " << m_iKey[1];
+  for (int i = 0; i < 4; i++) hOut << " " << m_iCounter[i];
+  for (int i = 0; i < 4; i++) hOut << " " << m_iBlock[i];
+  hOut << " " << m_iWord << "\n";
+  return hOut;
+}
+
+std::istream &Xenon1tPhiloxEngine::get(std::istream &hIn) {
+  std::string hName;
+  hIn >> hName;
+  if (hName != name()) {
+    hIn.clear(std::ios::badbit | hIn.rdstate());
+    return hIn;
+  }
+  return getState(hIn);
+}
+
+std::istream &Xenon1tPhiloxEngine::getState(std::istream &hIn) {
+  hIn >> m_iKey[0] >> m_iKey[1];
+  for (int i = 0; i < 4; i++) hIn >> m_iCounter[i];
+  for (int i = 0; i < 4; i++) hIn >> m_iBlock[i];
+  hIn >> m_iWord;
+  return hIn;
+}
@@ -0,0 +1,52 @@
+#ifndef __XENON1TPHILOXENGINE_H__
+#define __XENON1TPHILOXENGINE_H__
+
+#include <CLHEP/Random/RandomEngine.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Counter-based engine (Philox4x32-10, Salmon et al., SC11): the n-th
+// number of a stream is a bijective mix of (key, n), with no state besides
+// the counter. The key names the stream, the high half of the counter is
+// the global event number and the low half counts the draws of the event,
+// so that SetStream() positions the engine at the first number of any event
+// without drawing through the events before it. Two uniform doubles of 53
+// bits per block of four 32 bit words.
+//
+// setSeed()/setSeeds() only take the key, so that the per-event reseeding
+// of G4WorkerRunManager is harmless; the event is set by SetStream().
+
+class Xenon1tPhiloxEngine : public CLHEP::HepRandomEngine {
+ public:
+  Xenon1tPhiloxEngine();
+  virtual ~Xenon1tPhiloxEngine();
+
+  void SetStream(unsigned long long iKey, unsigned long long iEvent);
+
+  double flat();
+  void flatArray(const int iSize, double *pVector);
+  void setSeed(long iSeed, int);
+  void setSeeds(const long *pSeeds, int);
+  void saveStatus(const char szFileName[] = "Philox.conf") const;
+  void restoreStatus(const char szFileName[] = "Philox.conf");
+  void showStatus() const;
+  std::string name() const { return "Xenon1tPhiloxEngine"; }
+
+  std::ostream &put(std::ostream &hOut) const;
+  std::istream &get(std::istream &hIn);
+  std::istream &getState(std::istream &hIn);
+
+  operator unsigned int();
+
+ private:
+  void NextBlock();
+
+  unsigned int m_iKey[2];
+  unsigned int m_iCounter[4];
+  unsigned int m_iBlock[4];
+  int m_iWord;
+};
+
+#endif
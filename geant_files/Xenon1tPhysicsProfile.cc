@@ -0,0 +1,53 @@
+// XENON Header Files
+#include "Xenon1tPhysicsProfile.hh"
+#include "Xenon1tPhysicsProfileMessenger.hh"
+
+// G4 Header Files
+#include <G4DecayPhysics.hh>
+#include <G4EmLivermorePhysics.hh>
+#include <G4NeutronTrackingCut.hh>
+#include <G4RadioactiveDecayPhysics.hh>
+#include <G4VPhysicsConstructor.hh>
+
+Xenon1tPhysicsProfile *Xenon1tPhysicsProfile::m_pInstance = 0;
+
+Xenon1tPhysicsProfile *Xenon1tPhysicsProfile::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tPhysicsProfile();
+  return m_pInstance;
+}
+
+Xenon1tPhysicsProfile::Xenon1tPhysicsProfile() {
+  m_hProfile = "full";
+
+  m_pMessenger = new Xenon1tPhysicsProfileMessenger(this);
+}
+
+Xenon1tPhysicsProfile::~Xenon1tPhysicsProfile() {
+  for (size_t i = 0; i < m_hConstructors.size(); i++)
+    delete m_hConstructors[i];
+  delete m_pMessenger;
+}
+
+void Xenon1tPhysicsProfile::SetProfile(const G4String &hProfile) {
+  m_hProfile = hProfile;
+  G4cout << "Xenon1tPhysicsProfile: " << m_hProfile << " physics" << G4endl;
+
+  // the constructors are made once, on the master, like those of a modular
+  // physics list; ConstructProcess() runs on the master and on every worker
+  for (size_t i = 0; i < m_hConstructors.size(); i++)
+    delete m_hConstructors[i];
+  m_hConstructors.clear();
+  if (!IsLean()) return;
+
+  // radioactive decay needs the atomic deexcitation of the Livermore list
+  // for the x-rays and Auger electrons after electron capture
+  m_hConstructors.push_back(new G4EmLivermorePhysics());
+  m_hConstructors.push_back(new G4DecayPhysics());
+  m_hConstructors.push_back(new G4RadioactiveDecayPhysics());
+  m_hConstructors.push_back(new G4NeutronTrackingCut());
+}
+
+void Xenon1tPhysicsProfile::ConstructProcess() {
+  for (size_t i = 0; i < m_hConstructors.size(); i++)
+    m_hConstructors[i]->ConstructProcess();
+}
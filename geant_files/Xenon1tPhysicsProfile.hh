@@ -0,0 +1,51 @@
+#ifndef __XENON1TPHYSICSPROFILE_H__
+#define __XENON1TPHYSICSPROFILE_H__
+
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tPhysicsProfileMessenger;
+class G4VPhysicsConstructor;
+
+// Physics profile of the job, chosen in the preinit macro with
+// /Xe/physics/profile:
+//
+//   full  the complete Xenon1tPhysicsList (hadronic HP, optical, ...)
+//   er    only what the ER background runs from gamma/beta emitters need:
+//         Livermore EM, decay and radioactive decay, and a neutron tracking
+//         cut for the odd neutron; no optical processes (LXe and GdLScint
+//         scintillation off) and no G4ParticleHP, so that G4NDL is never
+//         read.
+//
+// Particles are defined by the full list either way, which costs nothing;
+// the profile only decides which processes ConstructProcess() attaches to
+// them: Xenon1tPhysicsList::ConstructProcess() calls
+// Xenon1tPhysicsProfile::ConstructProcess() after AddTransportation() and
+// returns when IsLean().
+
+class Xenon1tPhysicsProfile {
+ public:
+  static Xenon1tPhysicsProfile *GetInstance();
+  ~Xenon1tPhysicsProfile();
+
+  void SetProfile(const G4String &hProfile);
+  const G4String &GetProfile() const { return m_hProfile; }
+  G4bool IsLean() const { return m_hProfile == "er"; }
+
+  void ConstructProcess();
+
+ private:
+  Xenon1tPhysicsProfile();
+
+  static Xenon1tPhysicsProfile *m_pInstance;
+
+  G4String m_hProfile;
+  vector<G4VPhysicsConstructor *> m_hConstructors;
+
+  Xenon1tPhysicsProfileMessenger *m_pMessenger;
+};
+
+#endif
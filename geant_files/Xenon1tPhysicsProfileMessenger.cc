@@ -0,0 +1,34 @@
+// XENON Header Files
+#include "Xenon1tPhysicsProfileMessenger.hh"
+#include "Xenon1tPhysicsProfile.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tPhysicsProfileMessenger::Xenon1tPhysicsProfileMessenger(
+    Xenon1tPhysicsProfile *pProfile)
+    : m_pProfile(pProfile) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pPhysicsDir = new G4UIdirectory("/Xe/physics/", false);
+  m_pPhysicsDir->SetGuidance("Physics profile of the job.");
+
+  m_pProfileCmd = new G4UIcmdWithAString("/Xe/physics/profile", this);
+  m_pProfileCmd->SetGuidance("full: complete physics list.");
+  m_pProfileCmd->SetGuidance("er: Livermore EM and radioactive decay only, "
+                             "no optical or neutron HP physics.");
+  m_pProfileCmd->SetParameterName("profile", false);
+  m_pProfileCmd->SetCandidates("full er");
+  m_pProfileCmd->AvailableForStates(G4State_PreInit);
+}
+
+Xenon1tPhysicsProfileMessenger::~Xenon1tPhysicsProfileMessenger() {
+  delete m_pProfileCmd;
+  delete m_pPhysicsDir;
+}
+
+void Xenon1tPhysicsProfileMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                 G4String hNewValue) {
+  if (pUIcommand == m_pProfileCmd) m_pProfile->SetProfile(hNewValue);
+}
@@ -0,0 +1,26 @@
+#ifndef __XENON1TPHYSICSPROFILEMESSENGER_H__
+#define __XENON1TPHYSICSPROFILEMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tPhysicsProfile;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+
+class Xenon1tPhysicsProfileMessenger : public G4UImessenger {
+ public:
+  Xenon1tPhysicsProfileMessenger(Xenon1tPhysicsProfile *pProfile);
+  ~Xenon1tPhysicsProfileMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tPhysicsProfile *m_pProfile;
+
+  G4UIdirectory *m_pPhysicsDir;
+  G4UIcmdWithAString *m_pProfileCmd;
+};
+
+#endif
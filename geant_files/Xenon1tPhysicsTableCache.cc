@@ -0,0 +1,207 @@
+// XENON Header Files
+#include "Xenon1tPhysicsTableCache.hh"
+#include "Xenon1tPhysicsProfile.hh"
+#include "Xenon1tPhysicsTableCacheMessenger.hh"
+
+// Additional Header Files
+#include <cerrno>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::ifstream;
+using std::ofstream;
+using std::ostringstream;
+
+// G4 Header Files
+#include <G4Element.hh>
+#include <G4IonisParamMat.hh>
+#include <G4Material.hh>
+#include <G4ParticleTable.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProductionCuts.hh>
+#include <G4Region.hh>
+#include <G4RegionStore.hh>
+#include <G4VUserPhysicsList.hh>
+#include <G4Version.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tPhysicsTableCache *Xenon1tPhysicsTableCache::m_pInstance = 0;
+
+Xenon1tPhysicsTableCache *Xenon1tPhysicsTableCache::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tPhysicsTableCache();
+  return m_pInstance;
+}
+
+Xenon1tPhysicsTableCache::Xenon1tPhysicsTableCache() {
+  m_bActive = false;
+  m_hDirectory = "physics_tables";
+
+  m_pPhysicsList = 0;
+  m_bRetrieved = false;
+  m_bStored = false;
+
+  m_pMessenger = new Xenon1tPhysicsTableCacheMessenger(this);
+}
+
+Xenon1tPhysicsTableCache::~Xenon1tPhysicsTableCache() { delete m_pMessenger; }
+
+G4String Xenon1tPhysicsTableCache::BuildKey() const {
+  ostringstream hKey;
+  hKey << std::setprecision(12);
+
+  hKey << "geant4 " << G4VERSION_NUMBER << "\n";
+  hKey << "profile " << Xenon1tPhysicsProfile::GetInstance()->GetProfile()
+       << "\n";
+
+  G4ParticleTable::G4PTblDicIterator *pParticles =
+      G4ParticleTable::GetParticleTable()->GetIterator();
+  pParticles->reset();
+  while ((*pParticles)()) {
+    G4ParticleDefinition *pParticle = pParticles->value();
+    G4ProcessManager *pManager = pParticle->GetProcessManager();
+    if (!pManager) continue;
+
+    G4ProcessVector *pProcesses = pManager->GetProcessList();
+    hKey << "particle " << pParticle->GetParticleName();
+    for (G4int i = 0; i < pProcesses->size(); i++)
+      hKey << " " << (*pProcesses)[i]->GetProcessName();
+    hKey << "\n";
+  }
+
+  const G4MaterialTable *pMaterials = G4Material::GetMaterialTable();
+  for (size_t i = 0; i < pMaterials->size(); i++) {
+    const G4Material *pMaterial = (*pMaterials)[i];
+    hKey << "material " << pMaterial->GetName() << " "
+         << pMaterial->GetDensity() / (g / cm3) << " "
+         << pMaterial->GetState() << " " << pMaterial->GetTemperature() / kelvin
+         << " " << pMaterial->GetPressure() / atmosphere << " "
+         << pMaterial->GetIonisation()->GetMeanExcitationEnergy() / eV;
+    for (size_t j = 0; j < pMaterial->GetNumberOfElements(); j++) {
+      const G4Element *pElement = pMaterial->GetElement(j);
+      hKey << " " << pElement->GetName() << ":" << pElement->GetZ() << ":"
+           << pElement->GetN() << ":" << pMaterial->GetFractionVector()[j];
+    }
+    hKey << "\n";
+  }
+
+  G4RegionStore *pRegions = G4RegionStore::GetInstance();
+  for (size_t i = 0; i < pRegions->size(); i++) {
+    const G4Region *pRegion = (*pRegions)[i];
+    hKey << "region " << pRegion->GetName();
+    const G4ProductionCuts *pCuts = pRegion->GetProductionCuts();
+    if (pCuts)
+      for (G4int j = 0; j < NumberOfG4CutIndex; j++)
+        hKey << " " << pCuts->GetProductionCut(j) / mm;
+    hKey << "\n";
+  }
+
+  return hKey.str();
+}
+
+G4String Xenon1tPhysicsTableCache::Hash(const G4String &hText) {
+  // 64 bit FNV-1a, only used to name the directory: the key itself is
+  // compared on retrieval
+  unsigned long long iHash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < hText.length(); i++) {
+    iHash ^= (unsigned char)hText[i];
+    iHash *= 0x100000001b3ULL;
+  }
+
+  ostringstream hHash;
+  hHash << std::hex << std::setw(16) << std::setfill('0') << iHash;
+  return hHash.str();
+}
+
+G4bool Xenon1tPhysicsTableCache::ReadFile(const G4String &hFileName,
+                                          G4String &hText) {
+  ifstream hFile(hFileName.c_str());
+  if (!hFile.is_open()) return false;
+
+  ostringstream hContent;
+  hContent << hFile.rdbuf();
+  hText = hContent.str();
+  return true;
+}
+
+void Xenon1tPhysicsTableCache::Configure(G4VUserPhysicsList *pPhysicsList) {
+  if (!m_bActive) return;
+
+  m_pPhysicsList = pPhysicsList;
+  m_hKey = BuildKey();
+  m_hTableDirectory = m_hDirectory + "/" + Hash(m_hKey);
+  m_bRetrieved = false;
+  m_bStored = false;
+
+  G4String hStoredKey;
+  if (!ReadFile(m_hTableDirectory + "/key.txt", hStoredKey)) {
+    G4cout << "Xenon1tPhysicsTableCache: no tables in " << m_hTableDirectory
+           << ", building them" << G4endl;
+    return;
+  }
+
+  if (hStoredKey != m_hKey) {
+    G4Exception("Xenon1tPhysicsTableCache::Configure()", "PhysicsTableCache",
+                JustWarning,
+                ("Key of " + m_hTableDirectory +
+                 " does not match, building the tables").c_str());
+    m_bStored = true;
+    return;
+  }
+
+  m_pPhysicsList->SetPhysicsTableRetrieved(m_hTableDirectory);
+  m_bRetrieved = true;
+  G4cout << "Xenon1tPhysicsTableCache: retrieving tables from "
+         << m_hTableDirectory << G4endl;
+}
+
+void Xenon1tPhysicsTableCache::StoreTables() {
+  if (!m_bActive || !m_pPhysicsList || m_bRetrieved || m_bStored) return;
+  m_bStored = true;
+
+  mkdir(m_hDirectory.c_str(), 0755);
+
+  ostringstream hPrivate;
+  hPrivate << m_hTableDirectory << ".tmp." << getpid();
+  const G4String hPrivateDirectory = hPrivate.str();
+  if (mkdir(hPrivateDirectory.c_str(), 0755) != 0 && errno != EEXIST) {
+    G4Exception("Xenon1tPhysicsTableCache::StoreTables()", "PhysicsTableCache",
+                JustWarning,
+                ("Cannot create " + hPrivateDirectory).c_str());
+    return;
+  }
+
+  G4bool bComplete = m_pPhysicsList->StorePhysicsTable(hPrivateDirectory);
+  if (bComplete) {
+    ofstream hKeyFile((hPrivateDirectory + "/key.txt").c_str());
+    hKeyFile << m_hKey;
+    hKeyFile.close();
+    bComplete = !hKeyFile.fail();
+  }
+
+  // the rename fails if another task of the campaign was faster
+  if (bComplete &&
+      std::rename(hPrivateDirectory.c_str(), m_hTableDirectory.c_str()) == 0) {
+    G4cout << "Xenon1tPhysicsTableCache: tables stored in "
+           << m_hTableDirectory << G4endl;
+    return;
+  }
+
+  DIR *pDirectory = opendir(hPrivateDirectory.c_str());
+  if (pDirectory) {
+    struct dirent *pEntry;
+    while ((pEntry = readdir(pDirectory)) != 0) {
+      const G4String hName = pEntry->d_name;
+      if (hName != "." && hName != "..")
+        std::remove((hPrivateDirectory + "/" + hName).c_str());
+    }
+    closedir(pDirectory);
+  }
+  rmdir(hPrivateDirectory.c_str());
+}
@@ -0,0 +1,58 @@
+#ifndef __XENON1TPHYSICSTABLECACHE_H__
+#define __XENON1TPHYSICSTABLECACHE_H__
+
+#include <globals.hh>
+
+class Xenon1tPhysicsTableCacheMessenger;
+class G4VUserPhysicsList;
+
+// Cache of the built physics tables shared by the jobs of a campaign. The
+// tables are stored in <directory>/<hash>, where the hash is taken over
+// everything they depend on: Geant4 version, physics profile, the processes
+// of every particle, the materials (composition, density, state, mean
+// excitation energy) and the production cuts of every region. A job whose
+// key is found retrieves the tables instead of building them; any change
+// gives a new key, hence a new directory built from scratch.
+//
+// The first job of a key builds the tables as usual and stores them at the
+// beginning of its run, into a private directory renamed into place when
+// complete, so that concurrent array tasks never read half-written tables.
+// The key text is kept next to the tables and compared on retrieval.
+//
+// Xenon1tPhysicsList::SetCuts() calls Configure(this) at its end, the run
+// action calls StoreTables() in BeginOfRunAction().
+
+class Xenon1tPhysicsTableCache {
+ public:
+  static Xenon1tPhysicsTableCache *GetInstance();
+  ~Xenon1tPhysicsTableCache();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetDirectory(const G4String &hDirectory) { m_hDirectory = hDirectory; }
+
+  void Configure(G4VUserPhysicsList *pPhysicsList);
+  void StoreTables();
+
+ private:
+  Xenon1tPhysicsTableCache();
+
+  G4String BuildKey() const;
+  static G4String Hash(const G4String &hText);
+  static G4bool ReadFile(const G4String &hFileName, G4String &hText);
+
+  static Xenon1tPhysicsTableCache *m_pInstance;
+
+  G4bool m_bActive;
+  G4String m_hDirectory;
+
+  G4VUserPhysicsList *m_pPhysicsList;
+  G4String m_hKey;
+  G4String m_hTableDirectory;
+  G4bool m_bRetrieved;
+  G4bool m_bStored;
+
+  Xenon1tPhysicsTableCacheMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,44 @@
+// XENON Header Files
+#include "Xenon1tPhysicsTableCacheMessenger.hh"
+#include "Xenon1tPhysicsTableCache.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tPhysicsTableCacheMessenger::Xenon1tPhysicsTableCacheMessenger(
+    Xenon1tPhysicsTableCache *pCache)
+    : m_pCache(pCache) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pCacheDir = new G4UIdirectory("/Xe/physicsTables/", false);
+  m_pCacheDir->SetGuidance("Physics tables shared between jobs.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/physicsTables/setActive", this);
+  m_pActiveCmd->SetGuidance("Retrieve the tables if stored for the same "
+                            "materials, cuts and physics, else store them.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit);
+
+  m_pDirectoryCmd =
+      new G4UIcmdWithAString("/Xe/physicsTables/directory", this);
+  m_pDirectoryCmd->SetGuidance("Shared directory of the campaign, one "
+                               "sub-directory per key.");
+  m_pDirectoryCmd->SetParameterName("directory", false);
+  m_pDirectoryCmd->AvailableForStates(G4State_PreInit);
+}
+
+Xenon1tPhysicsTableCacheMessenger::~Xenon1tPhysicsTableCacheMessenger() {
+  delete m_pActiveCmd;
+  delete m_pDirectoryCmd;
+  delete m_pCacheDir;
+}
+
+void Xenon1tPhysicsTableCacheMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                    G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pCache->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pDirectoryCmd) m_pCache->SetDirectory(hNewValue);
+}
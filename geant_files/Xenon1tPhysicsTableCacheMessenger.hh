@@ -0,0 +1,28 @@
+#ifndef __XENON1TPHYSICSTABLECACHEMESSENGER_H__
+#define __XENON1TPHYSICSTABLECACHEMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tPhysicsTableCache;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+
+class Xenon1tPhysicsTableCacheMessenger : public G4UImessenger {
+ public:
+  Xenon1tPhysicsTableCacheMessenger(Xenon1tPhysicsTableCache *pCache);
+  ~Xenon1tPhysicsTableCacheMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tPhysicsTableCache *m_pCache;
+
+  G4UIdirectory *m_pCacheDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pDirectoryCmd;
+};
+
+#endif
@@ -0,0 +1,139 @@
+// XENON Header Files
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tQuasiRandomMessenger.hh"
+
+// Additional Header Files
+#include <cmath>
+#include <cstdlib>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4Threading.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4PhysicalConstants.hh>
+#endif
+
+G4ThreadLocal Xenon1tQuasiRandom *Xenon1tQuasiRandom::m_pInstance = 0;
+
+Xenon1tQuasiRandom *Xenon1tQuasiRandom::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tQuasiRandom();
+  return m_pInstance;
+}
+
+Xenon1tQuasiRandom::Xenon1tQuasiRandom() {
+  m_bActive = false;
+  m_iEventId = -1;
+  m_iIndex = 0;
+
+  InitialiseDirectionNumbers();
+
+  // array jobs get a different scramble per task without extra macros
+  const char *szTask = std::getenv("SLURM_ARRAY_TASK_ID");
+  SetScramble(szTask ? std::atoi(szTask) : 0);
+
+  m_pMessenger = new Xenon1tQuasiRandomMessenger(this);
+}
+
+Xenon1tQuasiRandom::~Xenon1tQuasiRandom() { delete m_pMessenger; }
+
+void Xenon1tQuasiRandom::InitialiseDirectionNumbers() {
+  // primitive polynomials (degree s, coefficients a) and initial m_i of the
+  // first dimensions of new-joe-kuo-6.21201; dimension 0 is van der Corput
+  static const G4int iDegree[eNumberOfDimensions] = {0, 1, 2, 3, 3};
+  static const G4int iCoefficients[eNumberOfDimensions] = {0, 0, 1, 1, 2};
+  static const unsigned int iInitial[eNumberOfDimensions][3] = {
+      {0, 0, 0}, {1, 0, 0}, {1, 3, 0}, {1, 3, 1}, {1, 1, 1}};
+
+  m_hDirectionNumbers.assign(eNumberOfDimensions * m_iBits, 0);
+  for (G4int iDimension = 0; iDimension < eNumberOfDimensions; iDimension++) {
+    unsigned int *pV = &m_hDirectionNumbers[iDimension * m_iBits];
+    const G4int s = iDegree[iDimension];
+
+    if (s == 0) {
+      for (G4int i = 0; i < m_iBits; i++) pV[i] = 1u << (m_iBits - 1 - i);
+      continue;
+    }
+
+    for (G4int i = 0; i < s; i++)
+      pV[i] = iInitial[iDimension][i] << (m_iBits - 1 - i);
+    for (G4int i = s; i < m_iBits; i++) {
+      pV[i] = pV[i - s] ^ (pV[i - s] >> s);
+      for (G4int k = 1; k < s; k++)
+        if ((iCoefficients[iDimension] >> (s - 1 - k)) & 1) pV[i] ^= pV[i - k];
+    }
+  }
+}
+
+void Xenon1tQuasiRandom::SetScramble(G4int iScramble) {
+  m_iScramble = iScramble;
+
+  // splitmix64 of the scramble index, one 32 bit digital shift per dimension;
+  // the worker threads of an MT job run independently shifted replicas
+  const G4int iThread =
+      G4Threading::IsWorkerThread() ? G4Threading::G4GetThreadId() + 1 : 0;
+  unsigned long long iState = 0x9E3779B97F4A7C15ULL * (iScramble + 1) +
+                              0xD1B54A32D192ED03ULL * iThread;
+  m_hShifts.resize(eNumberOfDimensions);
+  for (G4int i = 0; i < eNumberOfDimensions; i++) {
+    unsigned long long z = (iState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    m_hShifts[i] = (unsigned int)((z ^ (z >> 31)) >> 32);
+  }
+
+  m_hPoint.assign(eNumberOfDimensions, 0);
+  m_iIndex = 0;
+  m_iEventId = -1;
+}
+
+void Xenon1tQuasiRandom::SetIndex(unsigned int iIndex) {
+  // point iIndex - 1 in Gray code order is the XOR of the direction numbers
+  // of the bits of its Gray code
+  m_hPoint.assign(eNumberOfDimensions, 0);
+  m_iIndex = iIndex;
+  m_iEventId = -1;
+  if (iIndex == 0) return;
+
+  const unsigned int iGray = (iIndex - 1) ^ ((iIndex - 1) >> 1);
+  for (G4int iBit = 0; iBit < m_iBits; iBit++)
+    if (iGray & (1u << iBit))
+      for (G4int iDimension = 0; iDimension < eNumberOfDimensions;
+           iDimension++)
+        m_hPoint[iDimension] ^=
+            m_hDirectionNumbers[iDimension * m_iBits + iBit];
+}
+
+void Xenon1tQuasiRandom::BeginEvent(const G4Event *pEvent) {
+  if (!m_bActive || pEvent->GetEventID() == m_iEventId) return;
+  m_iEventId = pEvent->GetEventID();
+
+  // the first event takes point 0, then Gray code order: flip the direction
+  // number of the lowest zero bit of the previous index
+  if (m_iIndex > 0) {
+    G4int iBit = 0;
+    for (unsigned int i = m_iIndex - 1; i & 1; i >>= 1) iBit++;
+    if (iBit >= m_iBits)
+      G4Exception("Xenon1tQuasiRandom::BeginEvent()", "QuasiRandom",
+                  FatalException, "Sobol sequence exhausted");
+    for (G4int iDimension = 0; iDimension < eNumberOfDimensions; iDimension++)
+      m_hPoint[iDimension] ^= m_hDirectionNumbers[iDimension * m_iBits + iBit];
+  }
+  m_iIndex++;
+}
+
+G4double Xenon1tQuasiRandom::GetCoordinate(G4int iDimension) const {
+  if (!m_bActive || iDimension >= eNumberOfDimensions) return G4UniformRand();
+
+  // centre of the 2^-32 cell, never exactly 0 or 1
+  const unsigned int iValue = m_hPoint[iDimension] ^ m_hShifts[iDimension];
+  return (iValue + 0.5) / 4294967296.;
+}
+
+G4ThreeVector Xenon1tQuasiRandom::GetIsotropicDirection() const {
+  const G4double dCosTheta = 1. - 2. * GetCoordinate(eDirection1);
+  const G4double dSinTheta = std::sqrt(1. - dCosTheta * dCosTheta);
+  const G4double dPhi = twopi * GetCoordinate(eDirection2);
+  return G4ThreeVector(dSinTheta * std::cos(dPhi), dSinTheta * std::sin(dPhi),
+                       dCosTheta);
+}
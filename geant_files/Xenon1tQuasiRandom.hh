@@ -0,0 +1,76 @@
+#ifndef __XENON1TQUASIRANDOM_H__
+#define __XENON1TQUASIRANDOM_H__
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tQuasiRandomMessenger;
+class G4Event;
+
+// Randomised quasi-Monte Carlo for the primary vertex and the initial
+// direction: event n of a task uses point n of a Sobol sequence (Joe-Kuo
+// direction numbers) with a random digital shift per dimension. The shift
+// is derived from the scramble index, by default the array task id, so that
+// every task is an independent unbiased estimate: tasks are combined as
+// usual and the spread between tasks gives the error.
+//
+// Dimensions are assigned to fixed quantities, so that the same coordinate
+// always drives the same variable:
+//   eVertex1..3    vertex (surface source: facet, u, v; volume source: x y z)
+//   eDirection1..2 direction of the first emitted particle (cos theta, phi)
+// Everything else (cascade members, physics) stays pseudo-random.
+
+class Xenon1tQuasiRandom {
+ public:
+  enum Dimension {
+    eVertex1 = 0,
+    eVertex2,
+    eVertex3,
+    eDirection1,
+    eDirection2,
+    eNumberOfDimensions
+  };
+
+  static Xenon1tQuasiRandom *GetInstance();
+  ~Xenon1tQuasiRandom();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetScramble(G4int iScramble);
+  G4int GetScramble() const { return m_iScramble; }
+
+  // number of points used so far, to resume a checkpointed run
+  unsigned int GetIndex() const { return m_iIndex; }
+  void SetIndex(unsigned int iIndex);
+
+  // moves to the next point once per event, whoever calls it first
+  void BeginEvent(const G4Event *pEvent);
+
+  G4double GetCoordinate(G4int iDimension) const;
+  G4ThreeVector GetIsotropicDirection() const;
+
+ private:
+  Xenon1tQuasiRandom();
+
+  void InitialiseDirectionNumbers();
+
+  static G4ThreadLocal Xenon1tQuasiRandom *m_pInstance;
+
+  G4bool m_bActive;
+  G4int m_iScramble;
+  G4int m_iEventId;
+
+  static const G4int m_iBits = 32;
+  vector<unsigned int> m_hDirectionNumbers;
+  vector<unsigned int> m_hShifts;
+  vector<unsigned int> m_hPoint;
+  unsigned int m_iIndex;
+
+  Xenon1tQuasiRandomMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,45 @@
+// XENON Header Files
+#include "Xenon1tQuasiRandomMessenger.hh"
+#include "Xenon1tQuasiRandom.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tQuasiRandomMessenger::Xenon1tQuasiRandomMessenger(
+    Xenon1tQuasiRandom *pQuasiRandom)
+    : m_pQuasiRandom(pQuasiRandom) {
+  m_pQuasiRandomDir = new G4UIdirectory("/xe/gun/qmc/");
+  m_pQuasiRandomDir->SetGuidance("Scrambled Sobol sampling of vertex and "
+                                 "direction.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/xe/gun/qmc/setActive", this);
+  m_pActiveCmd->SetGuidance("Use quasi-random vertices and directions.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pScrambleCmd = new G4UIcmdWithAnInteger("/xe/gun/qmc/scramble", this);
+  m_pScrambleCmd->SetGuidance("Scramble index, one per array task (default "
+                              "SLURM_ARRAY_TASK_ID).");
+  m_pScrambleCmd->SetGuidance("Restarts the sequence.");
+  m_pScrambleCmd->SetParameterName("scramble", false);
+  m_pScrambleCmd->SetRange("scramble >= 0");
+  m_pScrambleCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tQuasiRandomMessenger::~Xenon1tQuasiRandomMessenger() {
+  delete m_pActiveCmd;
+  delete m_pScrambleCmd;
+  delete m_pQuasiRandomDir;
+}
+
+void Xenon1tQuasiRandomMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                              G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pQuasiRandom->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pScrambleCmd)
+    m_pQuasiRandom->SetScramble(m_pScrambleCmd->GetNewIntValue(hNewValue));
+}
@@ -0,0 +1,28 @@
+#ifndef __XENON1TQUASIRANDOMMESSENGER_H__
+#define __XENON1TQUASIRANDOMMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tQuasiRandom;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+
+class Xenon1tQuasiRandomMessenger : public G4UImessenger {
+ public:
+  Xenon1tQuasiRandomMessenger(Xenon1tQuasiRandom *pQuasiRandom);
+  ~Xenon1tQuasiRandomMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tQuasiRandom *m_pQuasiRandom;
+
+  G4UIdirectory *m_pQuasiRandomDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAnInteger *m_pScrambleCmd;
+};
+
+#endif
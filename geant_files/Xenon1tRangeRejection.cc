@@ -0,0 +1,151 @@
+// XENON Header Files
+#include "Xenon1tRangeRejection.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tRangeRejectionMessenger.hh"
+
+// Additional Header Files
+#include <cfloat>
+
+// G4 Header Files
+#include <G4LogicalVolume.hh>
+#include <G4LossTableManager.hh>
+#include <G4Material.hh>
+#include <G4MaterialCutsCouple.hh>
+#include <G4Navigator.hh>
+#include <G4Step.hh>
+#include <G4StepPoint.hh>
+#include <G4Track.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tRangeRejection *Xenon1tRangeRejection::m_pInstance = 0;
+
+Xenon1tRangeRejection *Xenon1tRangeRejection::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tRangeRejection();
+  return m_pInstance;
+}
+
+Xenon1tRangeRejection::Xenon1tRangeRejection() {
+  m_bActive = false;
+  // cryostats (SS316Ti or TiGrade1), tank and pipes, TPC structure
+  AddMaterial("SS316Ti");
+  AddMaterial("TiGrade1");
+  AddMaterial("SS304LSteel");
+  AddMaterial("Copper");
+  AddMaterial("Teflon");
+  AddMaterial("Torlon");
+  AddMaterial("Cirlex");
+  m_dMaxEnergy = 1. * MeV;
+
+  m_hTarget = "LXe";
+  m_bTargetReady = false;
+  m_pTarget = 0;
+
+  m_pMessenger = new Xenon1tRangeRejectionMessenger(this);
+}
+
+Xenon1tRangeRejection::~Xenon1tRangeRejection() { delete m_pMessenger; }
+
+void Xenon1tRangeRejection::AddMaterial(const G4String &hMaterial) {
+  m_hMaterials.push_back(hMaterial);
+  m_hTracks.push_back(0.);
+  m_hEnergies.push_back(0.);
+  m_bMaterialsReady = false;
+}
+
+void Xenon1tRangeRejection::ClearMaterials() {
+  m_hMaterials.clear();
+  m_hTracks.clear();
+  m_hEnergies.clear();
+  m_bMaterialsReady = false;
+}
+
+void Xenon1tRangeRejection::SetTarget(const G4String &hTarget) {
+  m_hTarget = hTarget;
+  m_bTargetReady = false;
+}
+
+G4int Xenon1tRangeRejection::GetMaterialIndex(const G4Material *pMaterial) {
+  // the material table is complete once the geometry is built
+  if (!m_bMaterialsReady) {
+    const G4MaterialTable *pMaterials = G4Material::GetMaterialTable();
+    m_hMaterialIndices.assign(pMaterials->size(), -1);
+    for (size_t i = 0; i < pMaterials->size(); i++)
+      for (size_t j = 0; j < m_hMaterials.size(); j++)
+        if ((*pMaterials)[i]->GetName() == m_hMaterials[j])
+          m_hMaterialIndices[i] = (G4int)j;
+    m_bMaterialsReady = true;
+  }
+
+  const size_t iIndex = pMaterial->GetIndex();
+  return (iIndex < m_hMaterialIndices.size()) ? m_hMaterialIndices[iIndex]
+                                              : -1;
+}
+
+G4double Xenon1tRangeRejection::GetDistanceToTarget(
+    const G4ThreeVector &hPosition) {
+  // the world is known to the navigator only after construction, so the
+  // target is looked up at the first track
+  if (!m_bTargetReady) {
+    m_pTarget = Xenon1tGeometryUtilities::FindTarget(
+        m_hTarget, "Xenon1tRangeRejection::GetDistanceToTarget()",
+        "only the safety in the current volume is used", m_hWorldToTarget);
+    m_bTargetReady = true;
+  }
+
+  return Xenon1tGeometryUtilities::GetDistanceToTarget(
+      m_pTarget, m_hWorldToTarget, hPosition);
+}
+
+G4bool Xenon1tRangeRejection::IsRejected(const G4Track &hTrack) {
+  if (!m_bActive) return false;
+
+  const G4double dEnergy = hTrack.GetKineticEnergy();
+  if (dEnergy <= 0. || dEnergy > m_dMaxEnergy) return false;
+  const G4MaterialCutsCouple *pCouple = hTrack.GetMaterialCutsCouple();
+  if (GetMaterialIndex(pCouple->GetMaterial()) < 0) return false;
+
+  const G4double dRange = G4LossTableManager::Instance()->GetRange(
+      hTrack.GetDefinition(), dEnergy, pCouple);
+
+  // after the first step the safety is known from the previous one
+  if (dRange < hTrack.GetStep()->GetPreStepPoint()->GetSafety()) return true;
+  if (hTrack.GetCurrentStepNumber() > 1) return false;
+
+  const G4ThreeVector &hPosition = hTrack.GetPosition();
+  G4Navigator *pNavigator = G4TransportationManager::GetTransportationManager()
+                                ->GetNavigatorForTracking();
+  if (dRange < pNavigator->ComputeSafety(hPosition)) return true;
+  return dRange < GetDistanceToTarget(hPosition);
+}
+
+void Xenon1tRangeRejection::AddRejected(const G4Track &hTrack) {
+  const G4int iMaterial = GetMaterialIndex(hTrack.GetMaterial());
+  if (iMaterial < 0) return;
+  m_hTracks[iMaterial] += 1.;
+  m_hEnergies[iMaterial] += hTrack.GetKineticEnergy();
+}
+
+void Xenon1tRangeRejection::PrintSettings() const {
+  G4cout << "Xenon1tRangeRejection: " << (m_bActive ? "active" : "inactive")
+         << ", target " << m_hTarget;
+  if (m_dMaxEnergy < DBL_MAX)
+    G4cout << ", below " << m_dMaxEnergy / keV << " keV";
+  G4cout << ", materials";
+  for (size_t i = 0; i < m_hMaterials.size(); i++)
+    G4cout << " " << m_hMaterials[i];
+  G4cout << G4endl;
+}
+
+void Xenon1tRangeRejection::PrintStatistics() const {
+  if (!m_bActive) return;
+  G4cout << "Xenon1tRangeRejection: rejected e-/e+ per material" << G4endl;
+  for (size_t i = 0; i < m_hMaterials.size(); i++)
+    if (m_hTracks[i] > 0.)
+      G4cout << "  " << m_hMaterials[i] << ": " << m_hTracks[i]
+             << " tracks, " << m_hEnergies[i] / MeV << " MeV" << G4endl;
+}
@@ -0,0 +1,90 @@
+#ifndef __XENON1TRANGEREJECTION_H__
+#define __XENON1TRANGEREJECTION_H__
+
+#include <G4ThreeVector.hh>
+#include <G4Transform3D.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tRangeRejectionMessenger;
+class G4Material;
+class G4Track;
+class G4VPhysicalVolume;
+
+// Range rejection of electrons and positrons in the passive materials
+// (cryostat steel, copper, PTFE, ...): a track whose range is shorter than
+// its distance to the xenon cannot deposit there, so it is stopped and its
+// kinetic energy deposited on the spot (positrons still annihilate at
+// rest). The distance is the larger of
+//
+//  - the isotropic safety of the navigator in the current volume: the
+//    track cannot leave the volume (PTFE pillars, copper rings inside the
+//    LXe), and
+//  - the safety to the solid of the target volume (/Xe/rangeRejection/
+//    target, LXe by default), which encloses all the xenon: the cryostat
+//    vessels.
+//
+// Both are lower bounds of the true distance. The range is the one of the
+// physics tables of the run (G4LossTableManager, per material-cuts couple),
+// from the restricted dE/dx, hence never shorter than the CSDA range.
+// Tracks are checked at their first step and whenever the safety of their
+// step is known, which makes the check nearly free.
+//
+// The bremsstrahlung photons the rejected track would still have made are
+// lost: the radiative yield is ~1% for 1 MeV electrons in steel or copper
+// and grows with the energy, hence the rejection is limited to kinetic
+// energies below maxEnergy (1 MeV by default, inf to drop the limit).
+// Rejected tracks and their energy are counted per material.
+//
+// Hook-ups: Xenon1tPhysicsList registers Xenon1tRangeRejectionProcess for
+// e- and e+, the run action calls PrintStatistics().
+
+class Xenon1tRangeRejection {
+ public:
+  static Xenon1tRangeRejection *GetInstance();
+  ~Xenon1tRangeRejection();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void AddMaterial(const G4String &hMaterial);
+  void ClearMaterials();
+  void SetMaxEnergy(G4double dMaxEnergy) { m_dMaxEnergy = dMaxEnergy; }
+  void SetTarget(const G4String &hTarget);
+
+  G4bool IsRejected(const G4Track &hTrack);
+  void AddRejected(const G4Track &hTrack);
+
+  void PrintSettings() const;
+  void PrintStatistics() const;
+
+ private:
+  Xenon1tRangeRejection();
+
+  G4int GetMaterialIndex(const G4Material *pMaterial);
+  G4double GetDistanceToTarget(const G4ThreeVector &hPosition);
+
+  static G4ThreadLocal Xenon1tRangeRejection *m_pInstance;
+
+  G4bool m_bActive;
+  vector<G4String> m_hMaterials;
+  G4double m_dMaxEnergy;
+
+  // index in m_hMaterials of every G4Material, -1 if not passive
+  G4bool m_bMaterialsReady;
+  vector<G4int> m_hMaterialIndices;
+
+  G4String m_hTarget;
+  G4bool m_bTargetReady;
+  G4VPhysicalVolume *m_pTarget;
+  G4Transform3D m_hWorldToTarget;
+
+  vector<G4double> m_hTracks;
+  vector<G4double> m_hEnergies;
+
+  Xenon1tRangeRejectionMessenger *m_pMessenger;
+};
+
+#endif
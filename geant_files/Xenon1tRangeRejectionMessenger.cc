@@ -0,0 +1,99 @@
+// XENON Header Files
+#include "Xenon1tRangeRejectionMessenger.hh"
+#include "Xenon1tRangeRejection.hh"
+
+// Additional Header Files
+#include <cfloat>
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tRangeRejectionMessenger::Xenon1tRangeRejectionMessenger(
+    Xenon1tRangeRejection *pRejection)
+    : m_pRejection(pRejection) {
+  m_pRejectionDir = new G4UIdirectory("/Xe/rangeRejection/");
+  m_pRejectionDir->SetGuidance("Stop e-/e+ that cannot reach the xenon.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/rangeRejection/setActive", this);
+  m_pActiveCmd->SetGuidance("Reject e-/e+ whose range is below their "
+                            "distance to the xenon.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pMaterialCmd =
+      new G4UIcmdWithAString("/Xe/rangeRejection/material", this);
+  m_pMaterialCmd->SetGuidance("Add a passive material to reject in.");
+  m_pMaterialCmd->SetParameterName("material", false);
+  m_pMaterialCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd = new G4UIcmdWithoutParameter("/Xe/rangeRejection/clear", this);
+  m_pClearCmd->SetGuidance("Remove all materials, also the default ones.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pMaxEnergyCmd = new G4UIcommand("/Xe/rangeRejection/maxEnergy", this);
+  m_pMaxEnergyCmd->SetGuidance("Reject only below this kinetic energy "
+                               "(bremsstrahlung), inf for no limit.");
+  m_pMaxEnergyCmd->SetGuidance("[usage] /Xe/rangeRejection/maxEnergy value "
+                               "unit");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("value", 's', false);
+  m_pMaxEnergyCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("keV");
+  m_pMaxEnergyCmd->SetParameter(pParameter);
+  m_pMaxEnergyCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTargetCmd = new G4UIcmdWithAString("/Xe/rangeRejection/target", this);
+  m_pTargetCmd->SetGuidance("Volume enclosing all the xenon.");
+  m_pTargetCmd->SetParameterName("volume", false);
+  m_pTargetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/rangeRejection/print", this);
+  m_pPrintCmd->SetGuidance("Print the settings and the rejected tracks.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tRangeRejectionMessenger::~Xenon1tRangeRejectionMessenger() {
+  delete m_pActiveCmd;
+  delete m_pMaterialCmd;
+  delete m_pClearCmd;
+  delete m_pMaxEnergyCmd;
+  delete m_pTargetCmd;
+  delete m_pPrintCmd;
+  delete m_pRejectionDir;
+}
+
+void Xenon1tRangeRejectionMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                 G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pRejection->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pMaterialCmd) m_pRejection->AddMaterial(hNewValue);
+
+  if (pUIcommand == m_pClearCmd) m_pRejection->ClearMaterials();
+
+  if (pUIcommand == m_pMaxEnergyCmd) {
+    G4String hValue, hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> hValue >> hUnit;
+    m_pRejection->SetMaxEnergy((hValue == "inf")
+                                   ? DBL_MAX
+                                   : G4UIcommand::ConvertToDouble(hValue) *
+                                         G4UIcommand::ValueOf(hUnit));
+  }
+
+  if (pUIcommand == m_pTargetCmd) m_pRejection->SetTarget(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) {
+    m_pRejection->PrintSettings();
+    m_pRejection->PrintStatistics();
+  }
+}
@@ -0,0 +1,33 @@
+#ifndef __XENON1TRANGEREJECTIONMESSENGER_H__
+#define __XENON1TRANGEREJECTIONMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tRangeRejection;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tRangeRejectionMessenger : public G4UImessenger {
+ public:
+  Xenon1tRangeRejectionMessenger(Xenon1tRangeRejection *pRejection);
+  ~Xenon1tRangeRejectionMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tRangeRejection *m_pRejection;
+
+  G4UIdirectory *m_pRejectionDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pMaterialCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcommand *m_pMaxEnergyCmd;
+  G4UIcmdWithAString *m_pTargetCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
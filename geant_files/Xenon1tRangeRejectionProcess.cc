@@ -0,0 +1,51 @@
+// XENON Header Files
+#include "Xenon1tRangeRejectionProcess.hh"
+#include "Xenon1tRangeRejection.hh"
+
+// Additional Header Files
+#include <cfloat>
+
+// G4 Header Files
+#include <G4Electron.hh>
+#include <G4Positron.hh>
+#include <G4Step.hh>
+#include <G4Track.hh>
+
+Xenon1tRangeRejectionProcess::Xenon1tRangeRejectionProcess(
+    const G4String &hName)
+    : G4VDiscreteProcess(hName, fGeneral) {
+  m_pRejection = Xenon1tRangeRejection::GetInstance();
+}
+
+Xenon1tRangeRejectionProcess::~Xenon1tRangeRejectionProcess() { ; }
+
+G4bool Xenon1tRangeRejectionProcess::IsApplicable(
+    const G4ParticleDefinition &hParticle) {
+  return &hParticle == G4Electron::Definition() ||
+         &hParticle == G4Positron::Definition();
+}
+
+G4double Xenon1tRangeRejectionProcess::PostStepGetPhysicalInteractionLength(
+    const G4Track &hTrack, G4double, G4ForceCondition *pCondition) {
+  *pCondition = NotForced;
+  return m_pRejection->IsRejected(hTrack) ? 0. : DBL_MAX;
+}
+
+G4double Xenon1tRangeRejectionProcess::GetMeanFreePath(const G4Track &,
+                                                       G4double,
+                                                       G4ForceCondition *) {
+  return DBL_MAX;
+}
+
+G4VParticleChange *Xenon1tRangeRejectionProcess::PostStepDoIt(
+    const G4Track &hTrack, const G4Step &) {
+  m_pRejection->AddRejected(hTrack);
+
+  aParticleChange.Initialize(hTrack);
+  aParticleChange.ProposeLocalEnergyDeposit(hTrack.GetKineticEnergy());
+  aParticleChange.ProposeEnergy(0.);
+  aParticleChange.ProposeTrackStatus(
+      (hTrack.GetDefinition() == G4Positron::Definition()) ? fStopButAlive
+                                                           : fStopAndKill);
+  return &aParticleChange;
+}
@@ -0,0 +1,34 @@
+#ifndef __XENON1TRANGEREJECTIONPROCESS_H__
+#define __XENON1TRANGEREJECTIONPROCESS_H__
+
+#include <G4VDiscreteProcess.hh>
+#include <globals.hh>
+
+class Xenon1tRangeRejection;
+
+// Stops the electrons and positrons that Xenon1tRangeRejection finds unable
+// to reach the xenon: limits their step to zero length and deposits their
+// kinetic energy there; positrons stay alive for the annihilation at rest.
+// Does nothing for every other step.
+
+class Xenon1tRangeRejectionProcess : public G4VDiscreteProcess {
+ public:
+  Xenon1tRangeRejectionProcess(const G4String &hName = "RangeRejection");
+  ~Xenon1tRangeRejectionProcess();
+
+  G4bool IsApplicable(const G4ParticleDefinition &hParticle);
+
+  G4double PostStepGetPhysicalInteractionLength(const G4Track &hTrack,
+                                                G4double dPreviousStepSize,
+                                                G4ForceCondition *pCondition);
+  G4VParticleChange *PostStepDoIt(const G4Track &hTrack, const G4Step &hStep);
+
+ protected:
+  G4double GetMeanFreePath(const G4Track &hTrack, G4double dPreviousStepSize,
+                           G4ForceCondition *pCondition);
+
+ private:
+  Xenon1tRangeRejection *m_pRejection;
+};
+
+#endif
@@ -0,0 +1,203 @@
+// XENON Header Files
+#include "Xenon1tRegions.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tRegionsMessenger.hh"
+
+// Additional Header Files
+#include <cfloat>
+
+// G4 Header Files
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4ProductionCuts.hh>
+#include <G4Region.hh>
+#include <G4RegionStore.hh>
+#include <G4UserLimits.hh>
+#include <G4VPhysicalVolume.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tRegions *Xenon1tRegions::m_pInstance = 0;
+
+Xenon1tRegions *Xenon1tRegions::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tRegions();
+  return m_pInstance;
+}
+
+Xenon1tRegions::Xenon1tRegions() {
+  m_bActive = false;
+
+  // fine cuts in the xenon, coarser with the distance from it
+  AddVolume("Xenon", "XenonLogicalVolume");
+  AddVolume("Xenon", "GXeLogicalVolume");
+  SetCut("Xenon", 0.1 * mm, "all");
+
+  AddVolume("TPCStructure", "XenonLogicalVolume/*");
+  AddVolume("TPCStructure", "GXeLogicalVolume/*");
+  SetCut("TPCStructure", 0.2 * mm, "all");
+
+  AddVolume("Cryostat", "OuterCryostatReflectorLogicalVolume");
+  AddVolume("Cryostat", "OuterCryostatUnionSolid");
+  SetCut("Cryostat", 1. * mm, "all");
+
+  AddVolume("WaterVeto", "WaterTankTubeLogicalVolume");
+  AddVolume("WaterVeto", "WaterTankConeLogicalVolume");
+  SetCut("WaterVeto", 1. * cm, "all");
+
+  AddVolume("LabRock", "RockLogicalVolume");
+  SetCut("LabRock", 5. * cm, "all");
+
+  m_pMessenger = new Xenon1tRegionsMessenger(this);
+}
+
+Xenon1tRegions::~Xenon1tRegions() { delete m_pMessenger; }
+
+Xenon1tRegions::RegionDefinition &Xenon1tRegions::GetDefinition(
+    const G4String &hRegion) {
+  for (size_t i = 0; i < m_hDefinitions.size(); i++)
+    if (m_hDefinitions[i].hName == hRegion) return m_hDefinitions[i];
+
+  RegionDefinition hDefinition;
+  hDefinition.hName = hRegion;
+  for (G4int j = 0; j < 4; j++) hDefinition.dCuts[j] = 0.7 * mm;
+  hDefinition.dMaxStep = DBL_MAX;
+  hDefinition.dMinEnergy = 0.;
+  hDefinition.pRegion = 0;
+  m_hDefinitions.push_back(hDefinition);
+  return m_hDefinitions.back();
+}
+
+void Xenon1tRegions::AddVolume(const G4String &hRegion,
+                               const G4String &hVolume) {
+  GetDefinition(hRegion).hVolumes.push_back(hVolume);
+}
+
+void Xenon1tRegions::ClearVolumes(const G4String &hRegion) {
+  GetDefinition(hRegion).hVolumes.clear();
+}
+
+void Xenon1tRegions::SetCut(const G4String &hRegion, G4double dCut,
+                            const G4String &hParticle) {
+  static const char *pParticles[4] = {"gamma", "e-", "e+", "proton"};
+
+  RegionDefinition &hDefinition = GetDefinition(hRegion);
+  G4bool bFound = false;
+  for (G4int j = 0; j < 4; j++)
+    if (hParticle == "all" || hParticle == pParticles[j]) {
+      hDefinition.dCuts[j] = dCut;
+      bFound = true;
+    }
+
+  if (!bFound)
+    G4Exception("Xenon1tRegions::SetCut()", "Regions", JustWarning,
+                ("No production cut for " + hParticle +
+                 ", use gamma, e-, e+, proton or all").c_str());
+}
+
+void Xenon1tRegions::SetStepLimit(const G4String &hRegion,
+                                  G4double dMaxStep) {
+  GetDefinition(hRegion).dMaxStep = dMaxStep;
+}
+
+void Xenon1tRegions::SetMinEnergy(const G4String &hRegion,
+                                  G4double dMinEnergy) {
+  GetDefinition(hRegion).dMinEnergy = dMinEnergy;
+}
+
+G4bool Xenon1tRegions::AddRoot(G4Region *pRegion, G4LogicalVolume *pVolume) {
+  // a volume that is already a root keeps its region
+  if (pVolume->IsRootRegion()) return false;
+
+  pRegion->AddRootLogicalVolume(pVolume);
+  return true;
+}
+
+G4int Xenon1tRegions::AddRoots(RegionDefinition &hDefinition,
+                               const G4String &hVolume) {
+  G4LogicalVolumeStore *pStore = G4LogicalVolumeStore::GetInstance();
+
+  const size_t iSlash = hVolume.find('/');
+  const G4String hMother = hVolume.substr(0, iSlash);
+  G4int iRoots = 0;
+  for (size_t i = 0; i < pStore->size(); i++) {
+    G4LogicalVolume *pVolume = (*pStore)[i];
+    if (!Xenon1tGeometryUtilities::MatchName(hMother, pVolume->GetName()))
+      continue;
+
+    if (iSlash == G4String::npos) {
+      if (AddRoot(hDefinition.pRegion, pVolume)) iRoots++;
+      continue;
+    }
+
+    const G4String hDaughter = hVolume.substr(iSlash + 1);
+    for (G4int j = 0; j < pVolume->GetNoDaughters(); j++) {
+      G4LogicalVolume *pDaughter = pVolume->GetDaughter(j)->GetLogicalVolume();
+      if (!Xenon1tGeometryUtilities::MatchName(hDaughter,
+                                               pDaughter->GetName()))
+        continue;
+      if (AddRoot(hDefinition.pRegion, pDaughter)) iRoots++;
+    }
+  }
+  return iRoots;
+}
+
+void Xenon1tRegions::Construct() {
+  if (!m_bActive) return;
+
+  for (size_t i = 0; i < m_hDefinitions.size(); i++) {
+    RegionDefinition &hDefinition = m_hDefinitions[i];
+
+    // rebuilt geometries reuse the region of the previous one
+    hDefinition.pRegion =
+        G4RegionStore::GetInstance()->GetRegion(hDefinition.hName, false);
+    if (!hDefinition.pRegion)
+      hDefinition.pRegion = new G4Region(hDefinition.hName);
+
+    G4ProductionCuts *pCuts = hDefinition.pRegion->GetProductionCuts();
+    if (!pCuts) {
+      pCuts = new G4ProductionCuts();
+      hDefinition.pRegion->SetProductionCuts(pCuts);
+    }
+    for (G4int j = 0; j < 4; j++)
+      pCuts->SetProductionCut(hDefinition.dCuts[j], j);
+
+    delete hDefinition.pRegion->GetUserLimits();
+    hDefinition.pRegion->SetUserLimits(new G4UserLimits(
+        hDefinition.dMaxStep, DBL_MAX, DBL_MAX, hDefinition.dMinEnergy));
+
+    G4int iRoots = 0;
+    for (size_t k = 0; k < hDefinition.hVolumes.size(); k++)
+      iRoots += AddRoots(hDefinition, hDefinition.hVolumes[k]);
+
+    if (!iRoots && !hDefinition.pRegion->GetNumberOfRootVolumes())
+      G4Exception("Xenon1tRegions::Construct()", "Regions", JustWarning,
+                  ("No volume of region " + hDefinition.hName +
+                   " in this geometry").c_str());
+  }
+
+  PrintRegions();
+}
+
+void Xenon1tRegions::PrintRegions() const {
+  G4cout << "Xenon1tRegions: " << (m_bActive ? "" : "inactive, ")
+         << m_hDefinitions.size() << " regions" << G4endl;
+  for (size_t i = 0; i < m_hDefinitions.size(); i++) {
+    const RegionDefinition &hDefinition = m_hDefinitions[i];
+    G4cout << "  " << hDefinition.hName << ":";
+    for (size_t k = 0; k < hDefinition.hVolumes.size(); k++)
+      G4cout << " " << hDefinition.hVolumes[k];
+    if (hDefinition.pRegion)
+      G4cout << " (" << hDefinition.pRegion->GetNumberOfRootVolumes()
+             << " roots)";
+    G4cout << G4endl << "    cuts gamma " << hDefinition.dCuts[0] / mm
+           << " mm, e- " << hDefinition.dCuts[1] / mm << " mm, e+ "
+           << hDefinition.dCuts[2] / mm << " mm, proton "
+           << hDefinition.dCuts[3] / mm << " mm";
+    if (hDefinition.dMaxStep < DBL_MAX)
+      G4cout << ", max step " << hDefinition.dMaxStep / mm << " mm";
+    if (hDefinition.dMinEnergy > 0.)
+      G4cout << ", min energy " << hDefinition.dMinEnergy / keV << " keV";
+    G4cout << G4endl;
+  }
+}
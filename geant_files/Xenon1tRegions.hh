@@ -0,0 +1,91 @@
+#ifndef __XENON1TREGIONS_H__
+#define __XENON1TREGIONS_H__
+
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tRegionsMessenger;
+class G4LogicalVolume;
+class G4Region;
+
+// Regions of the detector, each with its own production cuts and user
+// limits, instead of the single cut of the physics list from the rock to
+// the LXe. Off by default (/Xe/regions/setActive true in the preinit macro,
+// REGIONS in make_macros.py): the FV ER spectra with the regions have to be
+// shown to agree with the single-cut ones before they are used in
+// production. The regions are made in Construct(), at the end of the geometry,
+// from logical volume names ("*" wildcards); a name "mother/daughter" takes
+// the daughters of the mother that match. A volume that is already the root
+// of a region keeps it, so the order of the table matters:
+//
+//   Xenon         XenonLogicalVolume, GXeLogicalVolume       0.1 mm
+//   TPCStructure  XenonLogicalVolume/*, GXeLogicalVolume/*   0.2 mm
+//   Cryostat      OuterCryostatReflectorLogicalVolume,
+//                 OuterCryostatUnionSolid                     1 mm
+//   WaterVeto     WaterTankTubeLogicalVolume,
+//                 WaterTankConeLogicalVolume                  1 cm
+//   LabRock       RockLogicalVolume                           5 cm
+//
+// Everything below a root is in its region unless it is a root itself. The
+// reflector is a root of the cryostat region so that Xenon1tWoodcockTracking
+// finds its envelope already in a region and delta-tracks in it (without
+// the regions it makes a region of its own there).
+//
+// Cuts are set per particle (gamma, e-, e+, proton) or for all of them,
+// limits are a maximum step and a minimum kinetic energy:
+//
+//   /Xe/regions/cut LabRock 10 cm
+//   /Xe/regions/cut Xenon 50 um e-
+//   /Xe/regions/stepLimit Xenon 1 mm
+//   /Xe/regions/minEnergy LabRock 100 keV
+//
+// Hook-ups: the user limits are applied by G4StepLimiter and
+// G4UserSpecialCuts, Xenon1tPhysicsList registers G4StepLimiterPhysics.
+
+class Xenon1tRegions {
+ public:
+  static Xenon1tRegions *GetInstance();
+  ~Xenon1tRegions();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void AddVolume(const G4String &hRegion, const G4String &hVolume);
+  void ClearVolumes(const G4String &hRegion);
+  void SetCut(const G4String &hRegion, G4double dCut,
+              const G4String &hParticle);
+  void SetStepLimit(const G4String &hRegion, G4double dMaxStep);
+  void SetMinEnergy(const G4String &hRegion, G4double dMinEnergy);
+
+  void Construct();
+
+  void PrintRegions() const;
+
+ private:
+  Xenon1tRegions();
+
+  struct RegionDefinition {
+    G4String hName;
+    vector<G4String> hVolumes;
+    G4double dCuts[4];
+    G4double dMaxStep;
+    G4double dMinEnergy;
+    G4Region *pRegion;
+  };
+
+  RegionDefinition &GetDefinition(const G4String &hRegion);
+  G4int AddRoots(RegionDefinition &hDefinition, const G4String &hVolume);
+  static G4bool AddRoot(G4Region *pRegion, G4LogicalVolume *pVolume);
+
+  static Xenon1tRegions *m_pInstance;
+
+  G4bool m_bActive;
+  vector<RegionDefinition> m_hDefinitions;
+
+  Xenon1tRegionsMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,145 @@
+// XENON Header Files
+#include "Xenon1tRegionsMessenger.hh"
+#include "Xenon1tRegions.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tRegionsMessenger::Xenon1tRegionsMessenger(Xenon1tRegions *pRegions)
+    : m_pRegions(pRegions) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pRegionsDir = new G4UIdirectory("/Xe/regions/", false);
+  m_pRegionsDir->SetGuidance("Regions with their own cuts and limits.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/regions/setActive", this);
+  m_pActiveCmd->SetGuidance("Make the regions at construction, else the "
+                            "cut of the physics list applies everywhere.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit);
+
+  G4UIparameter *pParameter;
+  m_pVolumeCmd = new G4UIcommand("/Xe/regions/volume", this);
+  m_pVolumeCmd->SetGuidance("Add logical volumes to a region, \"*\" "
+                            "wildcards, mother/daughter for daughters.");
+  m_pVolumeCmd->SetGuidance("[usage] /Xe/regions/volume region volume");
+  pParameter = new G4UIparameter("region", 's', false);
+  m_pVolumeCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("volume", 's', false);
+  m_pVolumeCmd->SetParameter(pParameter);
+  m_pVolumeCmd->AvailableForStates(G4State_PreInit);
+
+  m_pClearCmd = new G4UIcmdWithAString("/Xe/regions/clear", this);
+  m_pClearCmd->SetGuidance("Remove the volumes of a region.");
+  m_pClearCmd->SetParameterName("region", false);
+  m_pClearCmd->AvailableForStates(G4State_PreInit);
+
+  m_pCutCmd = new G4UIcommand("/Xe/regions/cut", this);
+  m_pCutCmd->SetGuidance("Production cut (range) of a region.");
+  m_pCutCmd->SetGuidance("[usage] /Xe/regions/cut region value unit "
+                         "particle");
+  pParameter = new G4UIparameter("region", 's', false);
+  m_pCutCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("value", 'd', false);
+  pParameter->SetParameterRange("value > 0.");
+  m_pCutCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pCutCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("particle", 's', true);
+  pParameter->SetDefaultValue("all");
+  pParameter->SetParameterCandidates("all gamma e- e+ proton");
+  m_pCutCmd->SetParameter(pParameter);
+  m_pCutCmd->AvailableForStates(G4State_PreInit);
+
+  m_pStepLimitCmd = new G4UIcommand("/Xe/regions/stepLimit", this);
+  m_pStepLimitCmd->SetGuidance("Maximum step in a region (G4StepLimiter).");
+  m_pStepLimitCmd->SetGuidance("[usage] /Xe/regions/stepLimit region value "
+                               "unit");
+  pParameter = new G4UIparameter("region", 's', false);
+  m_pStepLimitCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("value", 'd', false);
+  pParameter->SetParameterRange("value > 0.");
+  m_pStepLimitCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pStepLimitCmd->SetParameter(pParameter);
+  m_pStepLimitCmd->AvailableForStates(G4State_PreInit);
+
+  m_pMinEnergyCmd = new G4UIcommand("/Xe/regions/minEnergy", this);
+  m_pMinEnergyCmd->SetGuidance("Kinetic energy below which tracks are "
+                               "stopped in a region (G4UserSpecialCuts).");
+  m_pMinEnergyCmd->SetGuidance("[usage] /Xe/regions/minEnergy region value "
+                               "unit");
+  pParameter = new G4UIparameter("region", 's', false);
+  m_pMinEnergyCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("value", 'd', false);
+  pParameter->SetParameterRange("value >= 0.");
+  m_pMinEnergyCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("keV");
+  m_pMinEnergyCmd->SetParameter(pParameter);
+  m_pMinEnergyCmd->AvailableForStates(G4State_PreInit);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/regions/print", this);
+  m_pPrintCmd->SetGuidance("Print the regions with their cuts and limits.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tRegionsMessenger::~Xenon1tRegionsMessenger() {
+  delete m_pActiveCmd;
+  delete m_pVolumeCmd;
+  delete m_pClearCmd;
+  delete m_pCutCmd;
+  delete m_pStepLimitCmd;
+  delete m_pMinEnergyCmd;
+  delete m_pPrintCmd;
+  delete m_pRegionsDir;
+}
+
+void Xenon1tRegionsMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                          G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pRegions->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pVolumeCmd) {
+    G4String hRegion, hVolume;
+    istringstream hStream(hNewValue);
+    hStream >> hRegion >> hVolume;
+    m_pRegions->AddVolume(hRegion, hVolume);
+  }
+
+  if (pUIcommand == m_pClearCmd) m_pRegions->ClearVolumes(hNewValue);
+
+  if (pUIcommand == m_pCutCmd) {
+    G4String hRegion, hUnit, hParticle;
+    G4double dValue;
+    istringstream hStream(hNewValue);
+    hStream >> hRegion >> dValue >> hUnit >> hParticle;
+    m_pRegions->SetCut(hRegion, dValue * G4UIcommand::ValueOf(hUnit),
+                       hParticle);
+  }
+
+  if (pUIcommand == m_pStepLimitCmd || pUIcommand == m_pMinEnergyCmd) {
+    G4String hRegion, hUnit;
+    G4double dValue;
+    istringstream hStream(hNewValue);
+    hStream >> hRegion >> dValue >> hUnit;
+    dValue *= G4UIcommand::ValueOf(hUnit);
+    if (pUIcommand == m_pStepLimitCmd)
+      m_pRegions->SetStepLimit(hRegion, dValue);
+    else
+      m_pRegions->SetMinEnergy(hRegion, dValue);
+  }
+
+  if (pUIcommand == m_pPrintCmd) m_pRegions->PrintRegions();
+}
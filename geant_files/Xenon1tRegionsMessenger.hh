@@ -0,0 +1,34 @@
+#ifndef __XENON1TREGIONSMESSENGER_H__
+#define __XENON1TREGIONSMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tRegions;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tRegionsMessenger : public G4UImessenger {
+ public:
+  Xenon1tRegionsMessenger(Xenon1tRegions *pRegions);
+  ~Xenon1tRegionsMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tRegions *m_pRegions;
+
+  G4UIdirectory *m_pRegionsDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pVolumeCmd;
+  G4UIcmdWithAString *m_pClearCmd;
+  G4UIcommand *m_pCutCmd;
+  G4UIcommand *m_pStepLimitCmd;
+  G4UIcommand *m_pMinEnergyCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
@@ -0,0 +1,169 @@
+// XENON Header Files
+#include "Xenon1tStackingRules.hh"
+#include "Xenon1tEventFilter.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tStackingRulesMessenger.hh"
+
+// Additional Header Files
+#include <cfloat>
+
+// G4 Header Files
+#include <G4LogicalVolume.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4StackManager.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tStackingRules *Xenon1tStackingRules::m_pInstance = 0;
+
+Xenon1tStackingRules *Xenon1tStackingRules::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tStackingRules();
+  return m_pInstance;
+}
+
+Xenon1tStackingRules::Xenon1tStackingRules() {
+  m_bActive = false;
+  m_hTarget = "LXe";
+  m_bTargetReady = false;
+  m_pTarget = 0;
+
+  m_pMessenger = new Xenon1tStackingRulesMessenger(this);
+}
+
+Xenon1tStackingRules::~Xenon1tStackingRules() { delete m_pMessenger; }
+
+void Xenon1tStackingRules::SetTarget(const G4String &hTarget) {
+  m_hTarget = hTarget;
+  m_bTargetReady = false;
+}
+
+void Xenon1tStackingRules::AddRule(const G4String &hAction,
+                                   const G4String &hParticle,
+                                   const G4String &hVolume,
+                                   G4double dMaxEnergy,
+                                   G4double dMinDistance) {
+  if (hAction != "kill" && hAction != "defer") {
+    G4Exception("Xenon1tStackingRules::AddRule()", "StackingRules",
+                JustWarning, ("Unknown action " + hAction).c_str());
+    return;
+  }
+
+  Rule hRule;
+  hRule.bKill = (hAction == "kill");
+  hRule.hParticle = hParticle;
+  hRule.hVolume = hVolume;
+  hRule.dMaxEnergy = dMaxEnergy;
+  hRule.dMinDistance = dMinDistance;
+  hRule.dTracks = 0.;
+  hRule.dEnergy = 0.;
+  hRule.dDropped = 0.;
+  m_hRules.push_back(hRule);
+}
+
+G4ClassificationOfNewTrack Xenon1tStackingRules::Classify(
+    const G4Track *pTrack, G4ClassificationOfNewTrack hDefault) {
+  if (!m_bActive || pTrack->GetParentID() == 0 || hDefault == fKill)
+    return hDefault;
+
+  for (size_t i = 0; i < m_hRules.size(); i++) {
+    Rule &hRule = m_hRules[i];
+    if (!Matches(hRule, pTrack)) continue;
+
+    hRule.dTracks += 1.;
+    hRule.dEnergy += pTrack->GetKineticEnergy();
+    if (hRule.bKill) return fKill;
+
+    if (m_hDeferred.size() != m_hRules.size())
+      m_hDeferred.assign(m_hRules.size(), 0);
+    m_hDeferred[i]++;
+    return fWaiting;
+  }
+  return hDefault;
+}
+
+G4bool Xenon1tStackingRules::Matches(const Rule &hRule,
+                                     const G4Track *pTrack) {
+  if (pTrack->GetKineticEnergy() >= hRule.dMaxEnergy) return false;
+
+  // radioactive daughters continue the chain wherever they are
+  const G4ParticleDefinition *pParticle = pTrack->GetDefinition();
+  if (pParticle->GetParticleType() == "nucleus" &&
+      (!pParticle->GetPDGStable() || pParticle->GetPDGLifeTime() > 0.))
+    return false;
+
+  if (!Xenon1tGeometryUtilities::MatchName(hRule.hParticle,
+                                           pParticle->GetParticleName()) &&
+      hRule.hParticle != pParticle->GetParticleType())
+    return false;
+
+  if (hRule.hVolume != "*") {
+    const G4VPhysicalVolume *pVolume = pTrack->GetVolume();
+    if (!pVolume ||
+        !Xenon1tGeometryUtilities::MatchName(hRule.hVolume,
+                                             pVolume->GetName()))
+      return false;
+  }
+
+  if (hRule.dMinDistance > 0. &&
+      GetDistanceToTarget(pTrack->GetPosition()) < hRule.dMinDistance)
+    return false;
+
+  return true;
+}
+
+G4double Xenon1tStackingRules::GetDistanceToTarget(
+    const G4ThreeVector &hPosition) {
+  // the world is known to the navigator only after construction, so the
+  // target is looked up at the first track
+  if (!m_bTargetReady) {
+    m_pTarget = Xenon1tGeometryUtilities::FindTarget(
+        m_hTarget, "Xenon1tStackingRules::GetDistanceToTarget()",
+        "distance rules never match", m_hWorldToTarget);
+    m_bTargetReady = true;
+  }
+
+  return Xenon1tGeometryUtilities::GetDistanceToTarget(
+      m_pTarget, m_hWorldToTarget, hPosition);
+}
+
+void Xenon1tStackingRules::NewStage(G4StackManager *pStackManager) {
+  if (m_hDeferred.empty()) return;
+
+  // the deferred tracks move to the urgent stack now, unless the event
+  // cannot pass the selection any more
+  if (Xenon1tEventFilter::GetInstance()->IsRejected()) {
+    for (size_t i = 0; i < m_hDeferred.size(); i++)
+      m_hRules[i].dDropped += m_hDeferred[i];
+    pStackManager->clear();
+  }
+  m_hDeferred.clear();
+}
+
+void Xenon1tStackingRules::PrepareNewEvent() {
+  // deferred tracks left from an aborted event were never simulated
+  for (size_t i = 0; i < m_hDeferred.size(); i++)
+    m_hRules[i].dDropped += m_hDeferred[i];
+  m_hDeferred.clear();
+}
+
+void Xenon1tStackingRules::PrintRules() const {
+  G4cout << "Xenon1tStackingRules: " << (m_bActive ? "active" : "inactive")
+         << ", target " << m_hTarget << G4endl;
+  for (size_t i = 0; i < m_hRules.size(); i++) {
+    const Rule &hRule = m_hRules[i];
+    G4cout << "  " << (hRule.bKill ? "kill " : "defer") << " "
+           << hRule.hParticle << " in " << hRule.hVolume;
+    if (hRule.dMaxEnergy < DBL_MAX)
+      G4cout << ", E < " << hRule.dMaxEnergy / keV << " keV";
+    if (hRule.dMinDistance > 0.)
+      G4cout << ", > " << hRule.dMinDistance / mm << " mm from " << m_hTarget;
+    G4cout << ": " << hRule.dTracks << " tracks, " << hRule.dEnergy / MeV
+           << " MeV";
+    if (!hRule.bKill) G4cout << ", " << hRule.dDropped << " never simulated";
+    G4cout << G4endl;
+  }
+}
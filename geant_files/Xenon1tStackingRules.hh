@@ -0,0 +1,102 @@
+#ifndef __XENON1TSTACKINGRULES_H__
+#define __XENON1TSTACKINGRULES_H__
+
+#include <G4ClassificationOfNewTrack.hh>
+#include <G4ThreeVector.hh>
+#include <G4Transform3D.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tStackingRulesMessenger;
+class G4StackManager;
+class G4Track;
+class G4VPhysicalVolume;
+
+// Rule table of the stacking action for secondaries that cannot matter for
+// the LXe: every new secondary is matched against the rules in order, the
+// first match kills it or defers it to the waiting stack. A rule matches on
+//
+//   particle  name or type, "*" wildcard as in /xe/gun/confine
+//             (anti_nu_*, nucleus, alpha, e-)
+//   volume    physical volume where the track was created (SS_*, *)
+//   energy    kinetic energy below emax
+//   distance  distance from the LXe (/Xe/stacking/target) of at least
+//             dmin; the isotropic safety is used, which is never larger
+//             than the true distance
+//
+//   /Xe/stacking/rule kill anti_nu_* * inf keV 0 mm
+//   /Xe/stacking/rule kill nucleus SS_* inf keV 0 mm
+//   /Xe/stacking/rule defer e- SS_* 500 keV 5 mm
+//
+// Deferred tracks are simulated after all the others, and only if the event
+// is still interesting (not rejected by Xenon1tEventFilter meanwhile).
+// Primaries and radioactive nuclei (the rest of the chain) are never
+// touched. Every rule counts its tracks and their
+// kinetic energy, printed with /Xe/stacking/print.
+//
+// Hook-ups: Xenon1tStackingAction::ClassifyNewTrack() returns
+// Classify(pTrack, <its own classification>), NewStage() calls
+// NewStage(stackManager) before its own stage handling and
+// PrepareNewEvent() calls PrepareNewEvent().
+
+class Xenon1tStackingRules {
+ public:
+  static Xenon1tStackingRules *GetInstance();
+  ~Xenon1tStackingRules();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetTarget(const G4String &hTarget);
+
+  void AddRule(const G4String &hAction, const G4String &hParticle,
+               const G4String &hVolume, G4double dMaxEnergy,
+               G4double dMinDistance);
+  void ClearRules() {
+    m_hRules.clear();
+    m_hDeferred.clear();
+  }
+
+  G4ClassificationOfNewTrack Classify(const G4Track *pTrack,
+                                      G4ClassificationOfNewTrack hDefault);
+  void NewStage(G4StackManager *pStackManager);
+  void PrepareNewEvent();
+
+  void PrintRules() const;
+
+ private:
+  Xenon1tStackingRules();
+
+  struct Rule {
+    G4bool bKill;
+    G4String hParticle;
+    G4String hVolume;
+    G4double dMaxEnergy;
+    G4double dMinDistance;
+    G4double dTracks;
+    G4double dEnergy;
+    G4double dDropped;
+  };
+
+  G4bool Matches(const Rule &hRule, const G4Track *pTrack);
+  G4double GetDistanceToTarget(const G4ThreeVector &hPosition);
+
+  static G4ThreadLocal Xenon1tStackingRules *m_pInstance;
+
+  G4bool m_bActive;
+  vector<Rule> m_hRules;
+
+  G4String m_hTarget;
+  G4bool m_bTargetReady;
+  G4VPhysicalVolume *m_pTarget;
+  G4Transform3D m_hWorldToTarget;
+
+  // deferred tracks of the current event, per rule
+  vector<G4int> m_hDeferred;
+
+  Xenon1tStackingRulesMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,107 @@
+// XENON Header Files
+#include "Xenon1tStackingRulesMessenger.hh"
+#include "Xenon1tStackingRules.hh"
+
+// Additional Header Files
+#include <cfloat>
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tStackingRulesMessenger::Xenon1tStackingRulesMessenger(
+    Xenon1tStackingRules *pRules)
+    : m_pRules(pRules) {
+  m_pStackingDir = new G4UIdirectory("/Xe/stacking/");
+  m_pStackingDir->SetGuidance("Kill or defer secondaries far from the LXe.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/stacking/setActive", this);
+  m_pActiveCmd->SetGuidance("Apply the rule table to new secondaries.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pRuleCmd = new G4UIcommand("/Xe/stacking/rule", this);
+  m_pRuleCmd->SetGuidance("Append a rule, the first matching rule applies.");
+  m_pRuleCmd->SetGuidance("[usage] /Xe/stacking/rule action particle volume "
+                          "emax eunit dmin dunit");
+  m_pRuleCmd->SetGuidance("action: kill or defer; emax: inf for no limit.");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("action", 's', false);
+  pParameter->SetParameterCandidates("kill defer");
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("particle", 's', false);
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("volume", 's', true);
+  pParameter->SetDefaultValue("*");
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("emax", 's', true);
+  pParameter->SetDefaultValue("inf");
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("eunit", 's', true);
+  pParameter->SetDefaultValue("keV");
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("dmin", 'd', true);
+  pParameter->SetDefaultValue(0.);
+  m_pRuleCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("dunit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pRuleCmd->SetParameter(pParameter);
+  m_pRuleCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd = new G4UIcmdWithoutParameter("/Xe/stacking/clear", this);
+  m_pClearCmd->SetGuidance("Remove all rules.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pTargetCmd = new G4UIcmdWithAString("/Xe/stacking/target", this);
+  m_pTargetCmd->SetGuidance("Volume the distances are measured to.");
+  m_pTargetCmd->SetParameterName("volume", false);
+  m_pTargetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/stacking/print", this);
+  m_pPrintCmd->SetGuidance("Print the rules with their track counts.");
+  m_pPrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tStackingRulesMessenger::~Xenon1tStackingRulesMessenger() {
+  delete m_pActiveCmd;
+  delete m_pRuleCmd;
+  delete m_pClearCmd;
+  delete m_pTargetCmd;
+  delete m_pPrintCmd;
+  delete m_pStackingDir;
+}
+
+void Xenon1tStackingRulesMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pRules->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pRuleCmd) {
+    G4String hAction, hParticle, hVolume, hMaxEnergy, hEnergyUnit,
+        hDistanceUnit;
+    G4double dMinDistance;
+    istringstream hStream(hNewValue);
+    hStream >> hAction >> hParticle >> hVolume >> hMaxEnergy >>
+        hEnergyUnit >> dMinDistance >> hDistanceUnit;
+    const G4double dMaxEnergy =
+        (hMaxEnergy == "inf")
+            ? DBL_MAX
+            : G4UIcommand::ConvertToDouble(hMaxEnergy) *
+                  G4UIcommand::ValueOf(hEnergyUnit);
+    m_pRules->AddRule(hAction, hParticle, hVolume, dMaxEnergy,
+                      dMinDistance * G4UIcommand::ValueOf(hDistanceUnit));
+  }
+
+  if (pUIcommand == m_pClearCmd) m_pRules->ClearRules();
+
+  if (pUIcommand == m_pTargetCmd) m_pRules->SetTarget(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) m_pRules->PrintRules();
+}
@@ -0,0 +1,32 @@
+#ifndef __XENON1TSTACKINGRULESMESSENGER_H__
+#define __XENON1TSTACKINGRULESMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tStackingRules;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tStackingRulesMessenger : public G4UImessenger {
+ public:
+  Xenon1tStackingRulesMessenger(Xenon1tStackingRules *pRules);
+  ~Xenon1tStackingRulesMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tStackingRules *m_pRules;
+
+  G4UIdirectory *m_pStackingDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcommand *m_pRuleCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcmdWithAString *m_pTargetCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
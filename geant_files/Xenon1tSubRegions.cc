@@ -0,0 +1,144 @@
+// XENON Header Files
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tSubRegions.hh"
+#include "Xenon1tSubRegionsMessenger.hh"
+
+// Additional Header Files
+#include <algorithm>
+
+// G4 Header Files
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tSubRegions *Xenon1tSubRegions::m_pInstance = 0;
+
+Xenon1tSubRegions *Xenon1tSubRegions::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tSubRegions();
+  return m_pInstance;
+}
+
+Xenon1tSubRegions::Xenon1tSubRegions() {
+  m_iConfinedId = 0;
+  m_pMessenger = new Xenon1tSubRegionsMessenger(this);
+}
+
+Xenon1tSubRegions::~Xenon1tSubRegions() { delete m_pMessenger; }
+
+G4int Xenon1tSubRegions::AddSubRegion(const G4String &hComponent,
+                                      const G4String &hName, G4double dRMin,
+                                      G4double dRMax, G4double dZMin,
+                                      G4double dZMax) {
+  // a name that is already declared adds a window to the same sub-region
+  G4int iId = GetSubRegionId(hName);
+  if (iId == 0) {
+    m_hNames.push_back(hName);
+    iId = (G4int)m_hNames.size();
+  }
+
+  SubRegionWindow hWindow;
+  hWindow.hComponent = hComponent;
+  hWindow.iId = iId;
+  hWindow.dRMin = dRMin;
+  hWindow.dRMax = dRMax;
+  hWindow.dZMin = dZMin;
+  hWindow.dZMax = dZMax;
+  m_hWindows.push_back(hWindow);
+
+  return iId;
+}
+
+void Xenon1tSubRegions::ClearSubRegions(const G4String &hComponent) {
+  // ids stay valid, only the windows of the component are dropped
+  vector<SubRegionWindow>::iterator pIt = m_hWindows.begin();
+  while (pIt != m_hWindows.end()) {
+    if (pIt->hComponent == hComponent)
+      pIt = m_hWindows.erase(pIt);
+    else
+      ++pIt;
+  }
+}
+
+G4int Xenon1tSubRegions::GetSubRegionId(const G4String &hName) const {
+  for (size_t i = 0; i < m_hNames.size(); i++)
+    if (m_hNames[i] == hName) return (G4int)i + 1;
+  return 0;
+}
+
+G4int Xenon1tSubRegions::GetSubRegionId(const G4String &hVolumeName,
+                                        const G4ThreeVector &hPosition) const {
+  const G4double dR = hPosition.perp();
+  const G4double dZ = hPosition.z();
+
+  // first matching window wins, so catch-all windows go last
+  for (size_t i = 0; i < m_hWindows.size(); i++) {
+    const SubRegionWindow &hWindow = m_hWindows[i];
+    if (!Xenon1tGeometryUtilities::MatchName(hWindow.hComponent, hVolumeName))
+      continue;
+    if (dR >= hWindow.dRMin && dR < hWindow.dRMax && dZ >= hWindow.dZMin &&
+        dZ < hWindow.dZMax)
+      return hWindow.iId;
+  }
+  return 0;
+}
+
+G4bool Xenon1tSubRegions::GetBoundingBox(const G4String &hVolumeName,
+                                         const G4String &hPattern,
+                                         G4double &dRMax, G4double &dZMin,
+                                         G4double &dZMax) const {
+  // windows earlier in the list take precedence, so the sub-region is only
+  // a part of its windows, but never more
+  G4bool bFound = false;
+  for (size_t i = 0; i < m_hWindows.size(); i++) {
+    const SubRegionWindow &hWindow = m_hWindows[i];
+    if (!Xenon1tGeometryUtilities::MatchName(hWindow.hComponent, hVolumeName) ||
+        !Xenon1tGeometryUtilities::MatchName(hPattern,
+                                             m_hNames[hWindow.iId - 1]))
+      continue;
+    dRMax = bFound ? std::max(dRMax, hWindow.dRMax) : hWindow.dRMax;
+    dZMin = bFound ? std::min(dZMin, hWindow.dZMin) : hWindow.dZMin;
+    dZMax = bFound ? std::max(dZMax, hWindow.dZMax) : hWindow.dZMax;
+    bFound = true;
+  }
+  return bFound;
+}
+
+G4String Xenon1tSubRegions::GetSubRegionName(G4int iSubRegionId) const {
+  if (iSubRegionId < 1 || iSubRegionId > (G4int)m_hNames.size()) return "None";
+  return m_hNames[iSubRegionId - 1];
+}
+
+void Xenon1tSubRegions::SetConfinement(const G4String &hName) {
+  if (hName == "None") {
+    m_iConfinedId = 0;
+    return;
+  }
+
+  m_iConfinedId = GetSubRegionId(hName);
+  if (m_iConfinedId == 0)
+    G4Exception("Xenon1tSubRegions::SetConfinement()", "SubRegions",
+                FatalException,
+                ("Sub-region " + hName + " is not declared").c_str());
+}
+
+G4bool Xenon1tSubRegions::AcceptVertex(const G4String &hVolumeName,
+                                       const G4ThreeVector &hPosition) const {
+  if (m_iConfinedId == 0) return true;
+  return GetSubRegionId(hVolumeName, hPosition) == m_iConfinedId;
+}
+
+void Xenon1tSubRegions::PrintSubRegions() const {
+  G4cout << "Xenon1tSubRegions: " << m_hNames.size()
+         << " sub-regions declared" << G4endl;
+  for (size_t i = 0; i < m_hWindows.size(); i++) {
+    const SubRegionWindow &hWindow = m_hWindows[i];
+    G4cout << "  [" << hWindow.iId << "] " << GetSubRegionName(hWindow.iId)
+           << " in " << hWindow.hComponent << ": r = [" << hWindow.dRMin / mm
+           << ", " << hWindow.dRMax / mm << "] mm, z = ["
+           << hWindow.dZMin / mm << ", " << hWindow.dZMax / mm << "] mm"
+           << G4endl;
+  }
+  if (m_iConfinedId)
+    G4cout << "  generation confined to "
+           << GetSubRegionName(m_iConfinedId) << G4endl;
+}
@@ -0,0 +1,70 @@
+#ifndef __XENON1TSUBREGIONS_H__
+#define __XENON1TSUBREGIONS_H__
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tSubRegionsMessenger;
+
+// Named sub-regions of a component (physical volume), declared as r/z windows
+// in world coordinates. A sub-region may be made of several windows, all of
+// them sharing the same compact id. Id 0 means "no declared sub-region".
+//
+// The particle source asks AcceptVertex() for every candidate vertex, so that
+// generation can be confined to a single sub-region. Xenon1tVolumeSampler
+// (the vertices of Xenon1tMixedSource) confines to the sub-region of its
+// component and stores GetSubRegionId() in the Xenon1tEventInformation of
+// the event.
+
+class Xenon1tSubRegions {
+ public:
+  static Xenon1tSubRegions *GetInstance();
+  ~Xenon1tSubRegions();
+
+  G4int AddSubRegion(const G4String &hComponent, const G4String &hName,
+                     G4double dRMin, G4double dRMax, G4double dZMin,
+                     G4double dZMax);
+  void ClearSubRegions(const G4String &hComponent);
+
+  G4int GetSubRegionId(const G4String &hName) const;
+  G4int GetSubRegionId(const G4String &hVolumeName,
+                       const G4ThreeVector &hPosition) const;
+  G4String GetSubRegionName(G4int iSubRegionId) const;
+  // world box around the windows in a volume of the sub-regions matching a
+  // name pattern: |x|, |y| < dRMax, dZMin <= z < dZMax; false if none
+  G4bool GetBoundingBox(const G4String &hVolumeName, const G4String &hPattern,
+                        G4double &dRMax, G4double &dZMin,
+                        G4double &dZMax) const;
+  G4int GetNumberOfSubRegions() const { return (G4int)m_hNames.size(); }
+
+  void SetConfinement(const G4String &hName);
+  G4int GetConfinement() const { return m_iConfinedId; }
+  G4bool AcceptVertex(const G4String &hVolumeName,
+                      const G4ThreeVector &hPosition) const;
+
+  void PrintSubRegions() const;
+
+ private:
+  Xenon1tSubRegions();
+
+  struct SubRegionWindow {
+    G4String hComponent;
+    G4int iId;
+    G4double dRMin, dRMax;
+    G4double dZMin, dZMax;
+  };
+
+  static Xenon1tSubRegions *m_pInstance;
+
+  vector<SubRegionWindow> m_hWindows;
+  vector<G4String> m_hNames;
+  G4int m_iConfinedId;
+
+  Xenon1tSubRegionsMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,101 @@
+// XENON Header Files
+#include "Xenon1tSubRegionsMessenger.hh"
+#include "Xenon1tSubRegions.hh"
+
+// Additional Header Files
+#include <cfloat>
+#include <sstream>
+
+using std::istringstream;
+
+// G4 Header Files
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+Xenon1tSubRegionsMessenger::Xenon1tSubRegionsMessenger(
+    Xenon1tSubRegions *pSubRegions)
+    : m_pSubRegions(pSubRegions) {
+  // one instance shared by all threads, the commands stay on the master
+  m_pSubRegionsDir = new G4UIdirectory("/Xe/subregion/", false);
+  m_pSubRegionsDir->SetGuidance("Named sub-regions of source components.");
+
+  m_pAddCmd = new G4UIcommand("/Xe/subregion/add", this);
+  m_pAddCmd->SetGuidance("Declare an r/z window (world frame) of a component.");
+  m_pAddCmd->SetGuidance("Windows sharing a name form one sub-region.");
+  m_pAddCmd->SetGuidance("Use inf/-inf for open bounds.");
+  m_pAddCmd->SetGuidance("[usage] /Xe/subregion/add component name rmin rmax "
+                         "zmin zmax unit");
+  G4UIparameter *pParameter;
+  pParameter = new G4UIparameter("component", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("name", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("rmin", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("rmax", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmin", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("zmax", 's', false);
+  m_pAddCmd->SetParameter(pParameter);
+  pParameter = new G4UIparameter("unit", 's', true);
+  pParameter->SetDefaultValue("mm");
+  m_pAddCmd->SetParameter(pParameter);
+  m_pAddCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd = new G4UIcmdWithAString("/Xe/subregion/clear", this);
+  m_pClearCmd->SetGuidance("Drop all windows declared for a component.");
+  m_pClearCmd->SetParameterName("component", false);
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pConfineCmd = new G4UIcmdWithAString("/Xe/subregion/confine", this);
+  m_pConfineCmd->SetGuidance("Confine primary vertices to one sub-region.");
+  m_pConfineCmd->SetGuidance("None switches the confinement off.");
+  m_pConfineCmd->SetParameterName("name", false);
+  m_pConfineCmd->SetDefaultValue("None");
+  m_pConfineCmd->AvailableForStates(G4State_Idle);
+
+  m_pListCmd = new G4UIcmdWithoutParameter("/Xe/subregion/list", this);
+  m_pListCmd->SetGuidance("Print the declared sub-regions.");
+  m_pListCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tSubRegionsMessenger::~Xenon1tSubRegionsMessenger() {
+  delete m_pAddCmd;
+  delete m_pClearCmd;
+  delete m_pConfineCmd;
+  delete m_pListCmd;
+  delete m_pSubRegionsDir;
+}
+
+void Xenon1tSubRegionsMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                             G4String hNewValue) {
+  if (pUIcommand == m_pAddCmd) {
+    G4String hComponent, hName, hRMin, hRMax, hZMin, hZMax, hUnit;
+    istringstream hStream(hNewValue);
+    hStream >> hComponent >> hName >> hRMin >> hRMax >> hZMin >> hZMax >>
+        hUnit;
+    const G4double dUnit = G4UIcommand::ValueOf(hUnit);
+    m_pSubRegions->AddSubRegion(hComponent, hName,
+                                ConvertToBound(hRMin, dUnit),
+                                ConvertToBound(hRMax, dUnit),
+                                ConvertToBound(hZMin, dUnit),
+                                ConvertToBound(hZMax, dUnit));
+  }
+
+  if (pUIcommand == m_pClearCmd) m_pSubRegions->ClearSubRegions(hNewValue);
+
+  if (pUIcommand == m_pConfineCmd) m_pSubRegions->SetConfinement(hNewValue);
+
+  if (pUIcommand == m_pListCmd) m_pSubRegions->PrintSubRegions();
+}
+
+G4double Xenon1tSubRegionsMessenger::ConvertToBound(const G4String &hValue,
+                                                    G4double dUnit) const {
+  if (hValue == "inf") return DBL_MAX;
+  if (hValue == "-inf") return -DBL_MAX;
+  return G4UIcommand::ConvertToDouble(hValue) * dUnit;
+}
@@ -0,0 +1,32 @@
+#ifndef __XENON1TSUBREGIONSMESSENGER_H__
+#define __XENON1TSUBREGIONSMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tSubRegions;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tSubRegionsMessenger : public G4UImessenger {
+ public:
+  Xenon1tSubRegionsMessenger(Xenon1tSubRegions *pSubRegions);
+  ~Xenon1tSubRegionsMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  G4double ConvertToBound(const G4String &hValue, G4double dUnit) const;
+
+  Xenon1tSubRegions *m_pSubRegions;
+
+  G4UIdirectory *m_pSubRegionsDir;
+  G4UIcommand *m_pAddCmd;
+  G4UIcmdWithAString *m_pClearCmd;
+  G4UIcmdWithAString *m_pConfineCmd;
+  G4UIcmdWithoutParameter *m_pListCmd;
+};
+
+#endif
@@ -0,0 +1,286 @@
+// XENON Header Files
+#include "Xenon1tSurfaceSource.hh"
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tSurfaceSourceMessenger.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+// G4 Header Files
+#include <G4GeometryTolerance.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+#include <G4Navigator.hh>
+#include <G4Polyhedron.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+G4ThreadLocal Xenon1tSurfaceSource *Xenon1tSurfaceSource::m_pInstance = 0;
+
+Xenon1tSurfaceSource *Xenon1tSurfaceSource::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tSurfaceSource();
+  return m_pInstance;
+}
+
+Xenon1tSurfaceSource::Xenon1tSurfaceSource() {
+  m_bActive = false;
+  m_dDepth = 0.;
+  m_hMedium = "None";
+  m_iRotationSteps = 360;
+  m_pWorld = 0;
+  m_bReady = false;
+  m_pNavigator = new G4Navigator();
+
+  m_pMessenger = new Xenon1tSurfaceSourceMessenger(this);
+}
+
+Xenon1tSurfaceSource::~Xenon1tSurfaceSource() {
+  delete m_pNavigator;
+  delete m_pMessenger;
+}
+
+void Xenon1tSurfaceSource::AddVolume(const G4String &hVolume) {
+  m_hVolumes.push_back(hVolume);
+  m_bReady = false;
+}
+
+void Xenon1tSurfaceSource::ClearVolumes() {
+  m_hVolumes.clear();
+  m_bReady = false;
+}
+
+void Xenon1tSurfaceSource::SetMedium(const G4String &hMedium) {
+  m_hMedium = hMedium;
+  m_bReady = false;
+}
+
+void Xenon1tSurfaceSource::SetRotationSteps(G4int iSteps) {
+  m_iRotationSteps = iSteps;
+  m_bReady = false;
+}
+
+G4bool Xenon1tSurfaceSource::SeesMedium(const G4ThreeVector &hPoint) {
+  const G4VPhysicalVolume *pVolume =
+      m_pNavigator->LocateGlobalPointAndSetup(hPoint, 0, false, true);
+  return pVolume &&
+         pVolume->GetLogicalVolume()->GetMaterial()->GetName() == m_hMedium;
+}
+
+void Xenon1tSurfaceSource::BuildTriangles() {
+  G4VPhysicalVolume *pWorld = G4TransportationManager::GetTransportationManager()
+                                  ->GetNavigatorForTracking()
+                                  ->GetWorldVolume();
+  m_pNavigator->SetWorldVolume(pWorld);
+
+  m_hPlacements.clear();
+  m_hToLocal.clear();
+  m_hTriangles.clear();
+  for (size_t i = 0; i < m_hVolumes.size(); i++) {
+    vector<Xenon1tGeometryUtilities::Placement> hPlacements =
+        Xenon1tGeometryUtilities::FindPlacements(m_hVolumes[i]);
+    if (hPlacements.empty())
+      G4Exception("Xenon1tSurfaceSource::BuildTriangles()", "SurfaceSource",
+                  FatalException,
+                  ("No volume matches " + m_hVolumes[i]).c_str());
+    m_hPlacements.insert(m_hPlacements.end(), hPlacements.begin(),
+                         hPlacements.end());
+  }
+  for (size_t i = 0; i < m_hPlacements.size(); i++)
+    m_hToLocal.push_back(m_hPlacements[i].hToWorld.inverse());
+
+  // curved surfaces are approximated by their facets, use a finer polyhedron
+  // than the one of the visualisation
+  G4Polyhedron::SetNumberOfRotationSteps(m_iRotationSteps);
+  const G4double dTolerance =
+      G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+
+  vector<G4double> hAreas;
+  G4double dRejectedArea = 0.;
+  for (size_t i = 0; i < m_hPlacements.size(); i++) {
+    const G4Transform3D &hToWorld = m_hPlacements[i].hToWorld;
+    G4Polyhedron *pPolyhedron =
+        m_hPlacements[i].pVolume->GetLogicalVolume()->GetSolid()
+            ->CreatePolyhedron();
+    if (!pPolyhedron) continue;
+
+    for (G4int iFace = 1; iFace <= pPolyhedron->GetNoFacets(); iFace++) {
+      G4int iNodes;
+      G4Point3D hNodes[4];
+      pPolyhedron->GetFacet(iFace, iNodes, hNodes);
+
+      G4ThreeVector hWorldNodes[4];
+      for (G4int j = 0; j < iNodes; j++)
+        hWorldNodes[j] = Xenon1tGeometryUtilities::ToWorld(
+            hToWorld, G4ThreeVector(hNodes[j].x(), hNodes[j].y(),
+                                    hNodes[j].z()));
+
+      // quadrilaterals are split in two triangles
+      for (G4int j = 1; j + 1 < iNodes; j++) {
+        Triangle hTriangle;
+        hTriangle.hVertex = hWorldNodes[0];
+        hTriangle.hEdge1 = hWorldNodes[j] - hWorldNodes[0];
+        hTriangle.hEdge2 = hWorldNodes[j + 1] - hWorldNodes[0];
+        const G4ThreeVector hCross = hTriangle.hEdge1.cross(hTriangle.hEdge2);
+        const G4double dArea = 0.5 * hCross.mag();
+        if (dArea <= 0.) continue;
+        hTriangle.hNormal = hCross.unit();
+        hTriangle.iPlacement = (G4int)i;
+
+        // probed from the real surface under the centroid, out along its
+        // normal by more than the sagitta of the facet and the tolerance
+        if (m_hMedium != "None") {
+          const G4ThreeVector hCentroid =
+              hTriangle.hVertex +
+              (hTriangle.hEdge1 + hTriangle.hEdge2) / 3.;
+          const G4VSolid *pSolid =
+              m_hPlacements[i].pVolume->GetLogicalVolume()->GetSolid();
+          G4ThreeVector hSurfacePoint;
+          G4double dSagitta = 0.;
+          G4ThreeVector hProbe = hCentroid + 1. * um * hTriangle.hNormal;
+          if (ProjectOnSurface(hTriangle, hCentroid, hSurfacePoint,
+                               dSagitta))
+            hProbe = Xenon1tGeometryUtilities::ToWorld(
+                hToWorld,
+                hSurfacePoint + (dSagitta + dTolerance + 1. * um) *
+                                    pSolid->SurfaceNormal(hSurfacePoint));
+          if (!SeesMedium(hProbe)) {
+            dRejectedArea += dArea;
+            continue;
+          }
+        }
+
+        m_hTriangles.push_back(hTriangle);
+        hAreas.push_back(dArea);
+      }
+    }
+    delete pPolyhedron;
+  }
+
+  G4Polyhedron::ResetNumberOfRotationSteps();
+
+  if (m_hTriangles.empty())
+    G4Exception("Xenon1tSurfaceSource::BuildTriangles()", "SurfaceSource",
+                FatalException, "No surface left to sample");
+  m_hAliasTable.Build(hAreas);
+
+  m_pWorld = pWorld;
+  m_bReady = true;
+
+  G4cout << "Xenon1tSurfaceSource: " << m_hPlacements.size()
+         << " placements, " << m_hTriangles.size() << " facets, area = "
+         << GetTotalArea() / cm2 << " cm2";
+  if (m_hMedium != "None")
+    G4cout << " facing " << m_hMedium << " (" << dRejectedArea / cm2
+           << " cm2 rejected)";
+  G4cout << ", depth = " << m_dDepth / um << " um" << G4endl;
+}
+
+G4bool Xenon1tSurfaceSource::ProjectOnSurface(const Triangle &hTriangle,
+                                              const G4ThreeVector &hFacetPoint,
+                                              G4ThreeVector &hSurfacePoint,
+                                              G4double &dDistance) const {
+  const G4Transform3D &hToLocal = m_hToLocal[hTriangle.iPlacement];
+  const G4VSolid *pSolid = m_hPlacements[hTriangle.iPlacement]
+                               .pVolume->GetLogicalVolume()
+                               ->GetSolid();
+  const G4ThreeVector hPoint =
+      Xenon1tGeometryUtilities::ToWorld(hToLocal, hFacetPoint);
+  const G4ThreeVector hNormal = hToLocal.getRotation() * hTriangle.hNormal;
+
+  // the facets of curved surfaces are off the real surface by up to their
+  // sagitta, move the point onto it along the facet normal
+  hSurfacePoint = hPoint;
+  const EInside eInside = pSolid->Inside(hPoint);
+  dDistance = 0.;
+  if (eInside == kOutside) {
+    dDistance = pSolid->DistanceToIn(hPoint, -hNormal);
+    hSurfacePoint = hPoint - dDistance * hNormal;
+  } else if (eInside == kInside) {
+    dDistance = pSolid->DistanceToOut(hPoint, hNormal);
+    hSurfacePoint = hPoint + dDistance * hNormal;
+  }
+
+  // a facet is never further from its surface than its size, a longer
+  // distance means the line missed the nearby surface
+  const G4double dSize = std::max(
+      std::max(hTriangle.hEdge1.mag(), hTriangle.hEdge2.mag()),
+      (hTriangle.hEdge2 - hTriangle.hEdge1).mag());
+  return dDistance <= dSize;
+}
+
+G4bool Xenon1tSurfaceSource::Implant(const Triangle &hTriangle,
+                                     const G4ThreeVector &hFacetPoint,
+                                     G4ThreeVector &hPosition) const {
+  G4ThreeVector hLocal;
+  G4double dDistance = 0.;
+  if (!ProjectOnSurface(hTriangle, hFacetPoint, hLocal, dDistance))
+    return false;
+
+  const Xenon1tGeometryUtilities::Placement &hPlacement =
+      m_hPlacements[hTriangle.iPlacement];
+  const G4VSolid *pSolid = hPlacement.pVolume->GetLogicalVolume()->GetSolid();
+  if (m_dDepth > 0.) {
+    hLocal -= m_dDepth * pSolid->SurfaceNormal(hLocal);
+    if (pSolid->Inside(hLocal) != kInside) return false;
+  }
+
+  hPosition = Xenon1tGeometryUtilities::ToWorld(hPlacement.hToWorld, hLocal);
+
+  // in the material of the volume, not in one of its daughters (e.g. a
+  // screw hole or an insert right below the surface)
+  if (m_dDepth > 0. &&
+      m_pNavigator->LocateGlobalPointAndSetup(hPosition, 0, false, true) !=
+          hPlacement.pVolume)
+    return false;
+  return true;
+}
+
+G4ThreeVector Xenon1tSurfaceSource::SamplePosition() {
+  G4VPhysicalVolume *pWorld = G4TransportationManager::GetTransportationManager()
+                                  ->GetNavigatorForTracking()
+                                  ->GetWorldVolume();
+  if (!m_bReady || pWorld != m_pWorld) BuildTriangles();
+
+  // the first trial takes the quasi-random coordinates, if any
+  Xenon1tQuasiRandom *pQuasiRandom = Xenon1tQuasiRandom::GetInstance();
+  const G4bool bQuasiRandom = pQuasiRandom->IsActive();
+
+  // a failed trial (the vertex would be outside of the volume) is redrawn
+  const G4int iMaxTrials = 1000;
+  G4ThreeVector hPosition;
+  for (G4int iTrial = 0; iTrial < iMaxTrials; iTrial++) {
+    const G4bool bFirst = bQuasiRandom && iTrial == 0;
+    const Triangle &hTriangle = m_hTriangles[m_hAliasTable.Sample(
+        bFirst ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex1)
+               : G4UniformRand())];
+
+    G4double dU = bFirst
+                      ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex2)
+                      : G4UniformRand();
+    G4double dV = bFirst
+                      ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex3)
+                      : G4UniformRand();
+    if (dU + dV > 1.) {
+      dU = 1. - dU;
+      dV = 1. - dV;
+    }
+    const G4ThreeVector hFacetPoint =
+        hTriangle.hVertex + dU * hTriangle.hEdge1 + dV * hTriangle.hEdge2;
+    if (Implant(hTriangle, hFacetPoint, hPosition)) return hPosition;
+  }
+
+  std::ostringstream hMessage;
+  hMessage << "No vertex inside the volume after " << iMaxTrials
+           << " trials, check the volumes and the depth ("
+           << m_dDepth / um << " um)";
+  G4Exception("Xenon1tSurfaceSource::SamplePosition()", "SurfaceSource",
+              FatalException, hMessage.str().c_str());
+  return hPosition;
+}
@@ -0,0 +1,90 @@
+#ifndef __XENON1TSURFACESOURCE_H__
+#define __XENON1TSURFACESOURCE_H__
+
+#include "Xenon1tAliasTable.hh"
+#include "Xenon1tGeometryUtilities.hh"
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tSurfaceSourceMessenger;
+class G4Navigator;
+class G4VPhysicalVolume;
+
+// Vertex sampler for surface contamination (radon plate-out). The outer
+// surfaces of the named volumes are triangulated once per geometry from
+// their G4Polyhedron, in world coordinates, and the triangles are drawn
+// from an alias table in proportion to their area. The point drawn on a
+// facet is moved onto the real surface of the solid along the facet normal
+// (facets of curved surfaces are off it by their sagitta, tens of um), and
+// the vertex is placed at the implantation depth below it, along the
+// inward surface normal. Points that end up outside of the volume or in
+// one of its daughters are redrawn.
+//
+// Optionally only the facets that see a given medium (LXe) are kept, tested
+// just outside the real surface under the facet centroid, e.g. the inner
+// face of Teflon_TPC but not its outer one.
+
+class Xenon1tSurfaceSource {
+ public:
+  static Xenon1tSurfaceSource *GetInstance();
+  ~Xenon1tSurfaceSource();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+
+  void AddVolume(const G4String &hVolume);
+  void ClearVolumes();
+  void SetDepth(G4double dDepth) { m_dDepth = dDepth; }
+  void SetMedium(const G4String &hMedium);
+  void SetRotationSteps(G4int iSteps);
+
+  G4ThreeVector SamplePosition();
+
+  G4double GetTotalArea() const { return m_hAliasTable.GetTotalWeight(); }
+
+ private:
+  Xenon1tSurfaceSource();
+
+  struct Triangle {
+    G4ThreeVector hVertex;
+    G4ThreeVector hEdge1, hEdge2;
+    G4ThreeVector hNormal;
+    G4int iPlacement;
+  };
+
+  void BuildTriangles();
+  G4bool SeesMedium(const G4ThreeVector &hPoint);
+  // facet point (world) onto the surface of the solid (local), false if
+  // the line along the facet normal misses it
+  G4bool ProjectOnSurface(const Triangle &hTriangle,
+                          const G4ThreeVector &hFacetPoint,
+                          G4ThreeVector &hSurfacePoint,
+                          G4double &dDistance) const;
+  G4bool Implant(const Triangle &hTriangle, const G4ThreeVector &hFacetPoint,
+                 G4ThreeVector &hPosition) const;
+
+  static G4ThreadLocal Xenon1tSurfaceSource *m_pInstance;
+
+  G4bool m_bActive;
+  vector<G4String> m_hVolumes;
+  G4double m_dDepth;
+  G4String m_hMedium;
+  G4int m_iRotationSteps;
+
+  const G4VPhysicalVolume *m_pWorld;
+  G4bool m_bReady;
+  vector<Xenon1tGeometryUtilities::Placement> m_hPlacements;
+  vector<G4Transform3D> m_hToLocal;
+  vector<Triangle> m_hTriangles;
+  Xenon1tAliasTable m_hAliasTable;
+  G4Navigator *m_pNavigator;
+
+  Xenon1tSurfaceSourceMessenger *m_pMessenger;
+};
+
+#endif
@@ -0,0 +1,85 @@
+// XENON Header Files
+#include "Xenon1tSurfaceSourceMessenger.hh"
+#include "Xenon1tSurfaceSource.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tSurfaceSourceMessenger::Xenon1tSurfaceSourceMessenger(
+    Xenon1tSurfaceSource *pSurfaceSource)
+    : m_pSurfaceSource(pSurfaceSource) {
+  m_pSurfaceDir = new G4UIdirectory("/xe/gun/surface/");
+  m_pSurfaceDir->SetGuidance("Surface contamination source.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/xe/gun/surface/setActive", this);
+  m_pActiveCmd->SetGuidance("Sample the vertices on the surfaces of the "
+                            "volumes instead of inside them.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pVolumeCmd = new G4UIcmdWithAString("/xe/gun/surface/volume", this);
+  m_pVolumeCmd->SetGuidance("Add a physical volume (trailing * matches a "
+                            "prefix).");
+  m_pVolumeCmd->SetParameterName("volume", false);
+  m_pVolumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pClearCmd = new G4UIcmdWithoutParameter("/xe/gun/surface/clear", this);
+  m_pClearCmd->SetGuidance("Remove all volumes.");
+  m_pClearCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pDepthCmd = new G4UIcmdWithADoubleAndUnit("/xe/gun/surface/depth", this);
+  m_pDepthCmd->SetGuidance("Implantation depth below the surface.");
+  m_pDepthCmd->SetParameterName("depth", false);
+  m_pDepthCmd->SetRange("depth >= 0.");
+  m_pDepthCmd->SetDefaultUnit("nm");
+  m_pDepthCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pMediumCmd = new G4UIcmdWithAString("/xe/gun/surface/medium", this);
+  m_pMediumCmd->SetGuidance("Keep only the faces that see this material "
+                            "(e.g. LXe), None keeps all.");
+  m_pMediumCmd->SetParameterName("medium", false);
+  m_pMediumCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  m_pRotationStepsCmd =
+      new G4UIcmdWithAnInteger("/xe/gun/surface/rotationSteps", this);
+  m_pRotationStepsCmd->SetGuidance("Facets per full turn of curved "
+                                   "surfaces.");
+  m_pRotationStepsCmd->SetParameterName("steps", false);
+  m_pRotationStepsCmd->SetRange("steps >= 24");
+  m_pRotationStepsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+Xenon1tSurfaceSourceMessenger::~Xenon1tSurfaceSourceMessenger() {
+  delete m_pActiveCmd;
+  delete m_pVolumeCmd;
+  delete m_pClearCmd;
+  delete m_pDepthCmd;
+  delete m_pMediumCmd;
+  delete m_pRotationStepsCmd;
+  delete m_pSurfaceDir;
+}
+
+void Xenon1tSurfaceSourceMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pSurfaceSource->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pVolumeCmd) m_pSurfaceSource->AddVolume(hNewValue);
+
+  if (pUIcommand == m_pClearCmd) m_pSurfaceSource->ClearVolumes();
+
+  if (pUIcommand == m_pDepthCmd)
+    m_pSurfaceSource->SetDepth(m_pDepthCmd->GetNewDoubleValue(hNewValue));
+
+  if (pUIcommand == m_pMediumCmd) m_pSurfaceSource->SetMedium(hNewValue);
+
+  if (pUIcommand == m_pRotationStepsCmd)
+    m_pSurfaceSource->SetRotationSteps(
+        m_pRotationStepsCmd->GetNewIntValue(hNewValue));
+}
@@ -0,0 +1,35 @@
+#ifndef __XENON1TSURFACESOURCEMESSENGER_H__
+#define __XENON1TSURFACESOURCEMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tSurfaceSource;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tSurfaceSourceMessenger : public G4UImessenger {
+ public:
+  Xenon1tSurfaceSourceMessenger(Xenon1tSurfaceSource *pSurfaceSource);
+  ~Xenon1tSurfaceSourceMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tSurfaceSource *m_pSurfaceSource;
+
+  G4UIdirectory *m_pSurfaceDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pVolumeCmd;
+  G4UIcmdWithoutParameter *m_pClearCmd;
+  G4UIcmdWithADoubleAndUnit *m_pDepthCmd;
+  G4UIcmdWithAString *m_pMediumCmd;
+  G4UIcmdWithAnInteger *m_pRotationStepsCmd;
+};
+
+#endif
@@ -0,0 +1,27 @@
+// XENON Header Files
+#include "Xenon1tThreadOutput.hh"
+
+// Additional Header Files
+#include <sstream>
+
+using std::ostringstream;
+
+// G4 Header Files
+#include <G4Threading.hh>
+
+G4int Xenon1tThreadOutput::m_iProcessId = -1;
+
+G4String Xenon1tThreadOutput::GetFileName(const G4String &hFileName) {
+  ostringstream hSuffix;
+  if (m_iProcessId >= 0) hSuffix << "_p" << m_iProcessId;
+  if (G4Threading::IsWorkerThread())
+    hSuffix << "_t" << G4Threading::G4GetThreadId();
+  if (hSuffix.str().empty()) return hFileName;
+
+  const size_t iDot = hFileName.rfind('.');
+  const size_t iSlash = hFileName.rfind('/');
+  if (iDot == std::string::npos ||
+      (iSlash != std::string::npos && iDot < iSlash))
+    return hFileName + hSuffix.str();
+  return hFileName.substr(0, iDot) + hSuffix.str() + hFileName.substr(iDot);
+}
@@ -0,0 +1,26 @@
+#ifndef __XENON1TTHREADOUTPUT_H__
+#define __XENON1TTHREADOUTPUT_H__
+
+#include <globals.hh>
+
+// Output files of MT runs: every worker thread writes its own file, named
+// after the one given to the job with the thread id before the extension
+// (out.root -> out_t3.root), so that no file is shared between threads.
+// Forked worker processes (Xenon1tForkRunner) likewise get _p<id>. The
+// files of a job are combined like the files of array tasks (hadd, or read
+// one by one by the notebooks). Sequential runs and the master keep the
+// name unchanged.
+
+class Xenon1tThreadOutput {
+ public:
+  static G4String GetFileName(const G4String &hFileName);
+
+  // id of the forked worker process, -1 in the parent and in plain runs
+  static void SetProcessId(G4int iProcessId) { m_iProcessId = iProcessId; }
+  static G4int GetProcessId() { return m_iProcessId; }
+
+ private:
+  static G4int m_iProcessId;
+};
+
+#endif
@@ -0,0 +1,150 @@
+// XENON Header Files
+#include "Xenon1tVolumeSampler.hh"
+#include "Xenon1tEventInformation.hh"
+#include "Xenon1tQuasiRandom.hh"
+#include "Xenon1tSubRegions.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cfloat>
+
+// G4 Header Files
+#include <G4Event.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Navigator.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <G4VisExtent.hh>
+#include <Randomize.hh>
+
+Xenon1tVolumeSampler::Xenon1tVolumeSampler(const G4String &hVolume,
+                                           const G4String &hSubRegion)
+    : m_hVolume(hVolume), m_hSubRegion(hSubRegion) {
+  m_bReady = false;
+  m_pNavigator = new G4Navigator();
+}
+
+Xenon1tVolumeSampler::~Xenon1tVolumeSampler() { delete m_pNavigator; }
+
+void Xenon1tVolumeSampler::BuildPlacements() {
+  m_pNavigator->SetWorldVolume(
+      G4TransportationManager::GetTransportationManager()
+          ->GetNavigatorForTracking()
+          ->GetWorldVolume());
+
+  m_hPlacements = Xenon1tGeometryUtilities::FindPlacements(m_hVolume);
+  if (m_hPlacements.empty())
+    G4Exception("Xenon1tVolumeSampler::BuildPlacements()", "VolumeSampler",
+                FatalException, ("No volume matches " + m_hVolume).c_str());
+
+  // points are drawn in the world box around the extent of a placement,
+  // cut to the box around the windows of the sub-region: a flange or the
+  // bottom dome is a small part of the cryostat extent, and a trial that
+  // misses it wastes the quasi-random point of the event
+  Xenon1tSubRegions *pSubRegions = Xenon1tSubRegions::GetInstance();
+  m_hBoxMin.clear();
+  m_hBoxMax.clear();
+  vector<G4double> hBoxVolumes;
+  for (size_t i = 0; i < m_hPlacements.size(); i++) {
+    const G4VisExtent hExtent =
+        m_hPlacements[i].pVolume->GetLogicalVolume()->GetSolid()->GetExtent();
+    G4ThreeVector hMin(DBL_MAX, DBL_MAX, DBL_MAX);
+    G4ThreeVector hMax(-DBL_MAX, -DBL_MAX, -DBL_MAX);
+    for (G4int iCorner = 0; iCorner < 8; iCorner++) {
+      const G4ThreeVector hCorner = Xenon1tGeometryUtilities::ToWorld(
+          m_hPlacements[i].hToWorld,
+          G4ThreeVector((iCorner & 1) ? hExtent.GetXmax() : hExtent.GetXmin(),
+                        (iCorner & 2) ? hExtent.GetYmax() : hExtent.GetYmin(),
+                        (iCorner & 4) ? hExtent.GetZmax() : hExtent.GetZmin()));
+      for (G4int j = 0; j < 3; j++) {
+        hMin[j] = std::min(hMin[j], hCorner[j]);
+        hMax[j] = std::max(hMax[j], hCorner[j]);
+      }
+    }
+
+    G4double dRMax, dZMin, dZMax;
+    if (!m_hSubRegion.empty() &&
+        pSubRegions->GetBoundingBox(m_hPlacements[i].pVolume->GetName(),
+                                    m_hSubRegion, dRMax, dZMin, dZMax)) {
+      hMin.set(std::max(hMin.x(), -dRMax), std::max(hMin.y(), -dRMax),
+               std::max(hMin.z(), dZMin));
+      hMax.set(std::min(hMax.x(), dRMax), std::min(hMax.y(), dRMax),
+               std::min(hMax.z(), dZMax));
+    }
+
+    // placements are drawn by the volume of their box, so that the
+    // rejection below leaves the vertices uniform over all of them
+    const G4ThreeVector hSize = hMax - hMin;
+    hBoxVolumes.push_back((hSize.x() > 0. && hSize.y() > 0. && hSize.z() > 0.)
+                              ? hSize.x() * hSize.y() * hSize.z()
+                              : 0.);
+    m_hBoxMin.push_back(hMin);
+    m_hBoxMax.push_back(hMax);
+  }
+  if (*std::max_element(hBoxVolumes.begin(), hBoxVolumes.end()) <= 0.)
+    G4Exception("Xenon1tVolumeSampler::BuildPlacements()", "VolumeSampler",
+                FatalException,
+                ("Sub-region " + m_hSubRegion + " is outside of " + m_hVolume)
+                    .c_str());
+  m_hAliasTable.Build(hBoxVolumes);
+
+  m_bReady = true;
+}
+
+G4bool Xenon1tVolumeSampler::AcceptPosition(G4int iPlacement,
+                                            const G4ThreeVector &hPosition,
+                                            G4int &iSubRegionId) {
+  const G4VPhysicalVolume *pVolume =
+      m_pNavigator->LocateGlobalPointAndSetup(hPosition, 0, false, true);
+  if (pVolume != m_hPlacements[iPlacement].pVolume) return false;
+
+  Xenon1tSubRegions *pSubRegions = Xenon1tSubRegions::GetInstance();
+  iSubRegionId = pSubRegions->GetSubRegionId(pVolume->GetName(), hPosition);
+  if (m_hSubRegion.empty()) return true;
+  return Xenon1tGeometryUtilities::MatchName(
+      m_hSubRegion, pSubRegions->GetSubRegionName(iSubRegionId));
+}
+
+G4ThreeVector Xenon1tVolumeSampler::SamplePosition(G4Event *pEvent) {
+  if (!m_bReady) BuildPlacements();
+
+  // the first trial takes the quasi-random coordinates, if any, as the
+  // surface source; the placement stays pseudo-random
+  Xenon1tQuasiRandom *pQuasiRandom = Xenon1tQuasiRandom::GetInstance();
+  pQuasiRandom->BeginEvent(pEvent);
+  const G4bool bQuasiRandom = pQuasiRandom->IsActive();
+
+  const G4int iMaxTrials = 100000;
+  for (G4int iTrial = 0; iTrial < iMaxTrials; iTrial++) {
+    const G4bool bFirst = bQuasiRandom && iTrial == 0;
+    const G4int iPlacement = m_hAliasTable.Sample();
+    const G4ThreeVector &hMin = m_hBoxMin[iPlacement];
+    const G4ThreeVector &hMax = m_hBoxMax[iPlacement];
+
+    const G4double dX =
+        bFirst ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex1)
+               : G4UniformRand();
+    const G4double dY =
+        bFirst ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex2)
+               : G4UniformRand();
+    const G4double dZ =
+        bFirst ? pQuasiRandom->GetCoordinate(Xenon1tQuasiRandom::eVertex3)
+               : G4UniformRand();
+    const G4ThreeVector hPosition(hMin.x() + dX * (hMax.x() - hMin.x()),
+                                  hMin.y() + dY * (hMax.y() - hMin.y()),
+                                  hMin.z() + dZ * (hMax.z() - hMin.z()));
+    G4int iSubRegionId = 0;
+    if (AcceptPosition(iPlacement, hPosition, iSubRegionId)) {
+      Xenon1tEventInformation::GetOrCreate(pEvent)->SetSubRegionId(
+          iSubRegionId);
+      return hPosition;
+    }
+  }
+
+  G4Exception("Xenon1tVolumeSampler::SamplePosition()", "VolumeSampler",
+              FatalException,
+              ("No vertex found in " + m_hVolume + " " + m_hSubRegion)
+                  .c_str());
+  return G4ThreeVector();
+}
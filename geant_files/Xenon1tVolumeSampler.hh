@@ -0,0 +1,55 @@
+#ifndef __XENON1TVOLUMESAMPLER_H__
+#define __XENON1TVOLUMESAMPLER_H__
+
+#include "Xenon1tAliasTable.hh"
+#include "Xenon1tGeometryUtilities.hh"
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class G4Event;
+class G4Navigator;
+
+// Uniform vertices in the material of the placements matching a volume name
+// (as /xe/gun/confine), optionally restricted to a declared sub-region
+// (trailing '*' matches several). Points are drawn in the world box around
+// the extent of each placement, cut to the r/z box of the sub-region
+// windows, and rejected when outside the placement (in one of its
+// daughters included) or outside the sub-region. With /xe/gun/qmc/ the
+// first trial of an event takes x, y, z from Xenon1tQuasiRandom, so the
+// gain shrinks with the acceptance of the box. The sub-region id of the
+// vertex (0 outside the declared ones) goes in the Xenon1tEventInformation
+// of the event.
+
+class Xenon1tVolumeSampler {
+ public:
+  Xenon1tVolumeSampler(const G4String &hVolume,
+                       const G4String &hSubRegion = "");
+  ~Xenon1tVolumeSampler();
+
+  G4ThreeVector SamplePosition(G4Event *pEvent);
+
+  const G4String &GetVolume() const { return m_hVolume; }
+  const G4String &GetSubRegion() const { return m_hSubRegion; }
+
+ private:
+  void BuildPlacements();
+  G4bool AcceptPosition(G4int iPlacement, const G4ThreeVector &hPosition,
+                        G4int &iSubRegionId);
+
+  G4String m_hVolume;
+  G4String m_hSubRegion;
+
+  G4bool m_bReady;
+  vector<Xenon1tGeometryUtilities::Placement> m_hPlacements;
+  vector<G4ThreeVector> m_hBoxMin;
+  vector<G4ThreeVector> m_hBoxMax;
+  Xenon1tAliasTable m_hAliasTable;
+  G4Navigator *m_pNavigator;
+};
+
+#endif
@@ -0,0 +1,112 @@
+// XENON Header Files
+#include "Xenon1tWoodcockModel.hh"
+#include "Xenon1tWoodcockTracking.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+
+// G4 Header Files
+#include <G4FastStep.hh>
+#include <G4FastTrack.hh>
+#include <G4Gamma.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Navigator.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4PhysicalConstants.hh>
+#include <G4SystemOfUnits.hh>
+#endif
+
+Xenon1tWoodcockModel::Xenon1tWoodcockModel(const G4String &hName,
+                                           G4Region *pEnvelope)
+    : G4VFastSimulationModel(hName, pEnvelope) {
+  m_pTracking = Xenon1tWoodcockTracking::GetInstance();
+  m_pNavigator = 0;
+  m_dMaximumPath = 0.;
+}
+
+Xenon1tWoodcockModel::~Xenon1tWoodcockModel() { delete m_pNavigator; }
+
+G4bool Xenon1tWoodcockModel::IsApplicable(
+    const G4ParticleDefinition &hParticle) {
+  return &hParticle == G4Gamma::Definition();
+}
+
+G4bool Xenon1tWoodcockModel::ModelTrigger(const G4FastTrack &hFastTrack) {
+  const G4Track *pTrack = hFastTrack.GetPrimaryTrack();
+
+  // an accepted collision is done by the process first
+  if (m_pTracking->IsPendingCollision(*pTrack)) return false;
+  if (!m_pTracking->IsInEnergyRange(pTrack->GetKineticEnergy())) return false;
+  if (m_pTracking->IsExcluded(pTrack)) return false;
+
+  const G4double dToOut = hFastTrack.GetEnvelopeSolid()->DistanceToOut(
+      hFastTrack.GetPrimaryTrackLocalPosition(),
+      hFastTrack.GetPrimaryTrackLocalDirection());
+  const G4double dToExcluded = m_pTracking->GetDistanceToExcluded(
+      pTrack->GetPosition(), pTrack->GetMomentumDirection());
+  m_dMaximumPath = std::min(dToOut, dToExcluded);
+
+  // on a surface normal transport takes the gamma across it
+  return m_dMaximumPath > 1. * um;
+}
+
+void Xenon1tWoodcockModel::DoIt(const G4FastTrack &hFastTrack,
+                                G4FastStep &hFastStep) {
+  if (!m_pNavigator) {
+    m_pNavigator = new G4Navigator();
+    m_pNavigator->SetWorldVolume(
+        G4TransportationManager::GetTransportationManager()
+            ->GetNavigatorForTracking()
+            ->GetWorldVolume());
+  }
+
+  const G4Track *pTrack = hFastTrack.GetPrimaryTrack();
+  const G4double dEnergy = pTrack->GetKineticEnergy();
+  const G4ThreeVector &hPosition = pTrack->GetPosition();
+  const G4ThreeVector &hDirection = pTrack->GetMomentumDirection();
+  const G4double dMajorant = m_pTracking->GetMajorant(dEnergy);
+
+  G4double dPath = 0.;
+  G4int iNullCollisions = 0;
+  G4bool bRealCollision = false;
+
+  while (true) {
+    dPath += -std::log(G4UniformRand()) / dMajorant;
+    if (dPath >= m_dMaximumPath) {
+      dPath = m_dMaximumPath;
+      break;
+    }
+
+    // only the material at the tentative collision is needed
+    const G4ThreeVector hCollision = hPosition + dPath * hDirection;
+    G4VPhysicalVolume *pVolume =
+        m_pNavigator->LocateGlobalPointAndSetup(hCollision, &hDirection, false,
+                                                true);
+    const G4double dCrossSection = m_pTracking->GetCrossSection(
+        dEnergy, pVolume->GetLogicalVolume()->GetMaterialCutsCouple());
+    if (dCrossSection > dMajorant) m_pTracking->CountMajorantViolation();
+
+    if (G4UniformRand() * dMajorant < dCrossSection) {
+      bRealCollision = true;
+      break;
+    }
+    iNullCollisions++;
+  }
+
+  const G4ThreeVector hFinalPosition = hPosition + dPath * hDirection;
+  hFastStep.ProposePrimaryTrackFinalPosition(hFinalPosition, false);
+  hFastStep.ProposePrimaryTrackFinalTime(pTrack->GetGlobalTime() +
+                                         dPath / c_light);
+  hFastStep.ProposePrimaryTrackFinalProperTime(pTrack->GetProperTime());
+  hFastStep.ProposePrimaryTrackPathLength(dPath);
+
+  if (bRealCollision)
+    m_pTracking->SetPendingCollision(pTrack, hFinalPosition);
+  m_pTracking->ResetInteractionLengths(pTrack);
+  m_pTracking->CountFlight(iNullCollisions, bRealCollision);
+}
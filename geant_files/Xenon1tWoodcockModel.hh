@@ -0,0 +1,33 @@
+#ifndef __XENON1TWOODCOCKMODEL_H__
+#define __XENON1TWOODCOCKMODEL_H__
+
+#include <G4VFastSimulationModel.hh>
+#include <globals.hh>
+
+class Xenon1tWoodcockTracking;
+class G4Navigator;
+
+// One Woodcock flight per fast step, see Xenon1tWoodcockTracking.hh. The
+// gamma is moved to the first real collision (left to
+// Xenon1tWoodcockProcess) or to the end of the straight path through the
+// envelope, whichever comes first; energy and direction do not change, and
+// the interaction lengths of the gamma processes are sampled anew.
+
+class Xenon1tWoodcockModel : public G4VFastSimulationModel {
+ public:
+  Xenon1tWoodcockModel(const G4String &hName, G4Region *pEnvelope);
+  ~Xenon1tWoodcockModel();
+
+  G4bool IsApplicable(const G4ParticleDefinition &hParticle);
+  G4bool ModelTrigger(const G4FastTrack &hFastTrack);
+  void DoIt(const G4FastTrack &hFastTrack, G4FastStep &hFastStep);
+
+ private:
+  Xenon1tWoodcockTracking *m_pTracking;
+  G4Navigator *m_pNavigator;
+
+  // path to the envelope surface or the excluded volume, from ModelTrigger
+  G4double m_dMaximumPath;
+};
+
+#endif
@@ -0,0 +1,42 @@
+// XENON Header Files
+#include "Xenon1tWoodcockProcess.hh"
+#include "Xenon1tWoodcockTracking.hh"
+
+// G4 Header Files
+#include <G4Gamma.hh>
+#include <G4Step.hh>
+#include <G4Track.hh>
+#include <G4VEmProcess.hh>
+
+Xenon1tWoodcockProcess::Xenon1tWoodcockProcess(const G4String &hName)
+    : G4VDiscreteProcess(hName, fGeneral) {
+  m_pTracking = Xenon1tWoodcockTracking::GetInstance();
+}
+
+Xenon1tWoodcockProcess::~Xenon1tWoodcockProcess() { ; }
+
+G4bool Xenon1tWoodcockProcess::IsApplicable(
+    const G4ParticleDefinition &hParticle) {
+  return &hParticle == G4Gamma::Definition();
+}
+
+G4double Xenon1tWoodcockProcess::PostStepGetPhysicalInteractionLength(
+    const G4Track &hTrack, G4double, G4ForceCondition *pCondition) {
+  *pCondition = NotForced;
+  return m_pTracking->IsPendingCollision(hTrack) ? 0. : DBL_MAX;
+}
+
+G4double Xenon1tWoodcockProcess::GetMeanFreePath(const G4Track &, G4double,
+                                                 G4ForceCondition *) {
+  return DBL_MAX;
+}
+
+G4VParticleChange *Xenon1tWoodcockProcess::PostStepDoIt(const G4Track &hTrack,
+                                                        const G4Step &hStep) {
+  m_pTracking->ClearPendingCollision();
+
+  // the gamma processes have looked up this material for this step already
+  G4VEmProcess *pProcess = m_pTracking->SelectProcess(
+      hTrack.GetKineticEnergy(), hTrack.GetMaterialCutsCouple());
+  return pProcess->PostStepDoIt(hTrack, hStep);
+}
@@ -0,0 +1,35 @@
+#ifndef __XENON1TWOODCOCKPROCESS_H__
+#define __XENON1TWOODCOCKPROCESS_H__
+
+#include <G4VDiscreteProcess.hh>
+#include <globals.hh>
+
+class Xenon1tWoodcockTracking;
+
+// Real collisions of Woodcock flights (Xenon1tWoodcockTracking.hh): limits
+// the step after an accepted collision to zero length and hands it to the
+// gamma process chosen by its cross-section in the material there, so that
+// the interaction itself is the one of the physics list. Does nothing for
+// every other step.
+
+class Xenon1tWoodcockProcess : public G4VDiscreteProcess {
+ public:
+  Xenon1tWoodcockProcess(const G4String &hName = "WoodcockCollision");
+  ~Xenon1tWoodcockProcess();
+
+  G4bool IsApplicable(const G4ParticleDefinition &hParticle);
+
+  G4double PostStepGetPhysicalInteractionLength(const G4Track &hTrack,
+                                                G4double dPreviousStepSize,
+                                                G4ForceCondition *pCondition);
+  G4VParticleChange *PostStepDoIt(const G4Track &hTrack, const G4Step &hStep);
+
+ protected:
+  G4double GetMeanFreePath(const G4Track &hTrack, G4double dPreviousStepSize,
+                           G4ForceCondition *pCondition);
+
+ private:
+  Xenon1tWoodcockTracking *m_pTracking;
+};
+
+#endif
@@ -0,0 +1,316 @@
+// XENON Header Files
+#include "Xenon1tWoodcockTracking.hh"
+#include "Xenon1tGeometryUtilities.hh"
+#include "Xenon1tWoodcockModel.hh"
+#include "Xenon1tWoodcockTrackingMessenger.hh"
+
+// Additional Header Files
+#include <algorithm>
+#include <cmath>
+
+// G4 Header Files
+#include <G4AtomicShells.hh>
+#include <G4Element.hh>
+#include <G4Gamma.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4Material.hh>
+#include <G4MaterialCutsCouple.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProductionCutsTable.hh>
+#include <G4Region.hh>
+#include <G4Threading.hh>
+#include <G4Track.hh>
+#include <G4VEmProcess.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <G4VTouchable.hh>
+#include <Randomize.hh>
+#if GEANTVERSION >= 10
+#include <G4SystemOfUnits.hh>
+#endif
+
+// majorant on a log grid, constant per bin. A bin is 4.7% wide in energy,
+// over which the photoelectric cross-section (~E^-3) changes by at most 15%:
+// that is the largest share of null collisions the binning adds, for a
+// table of a few hundred bins. The majorant is the sum over the processes
+// of their largest cross-section in the bin, taken at the bin edges and on
+// both sides of every absorption edge of the envelope materials (between
+// two edges every partial cross-section is monotonic, except for the flat
+// top of the incoherent one, which the 1% margin covers: its curvature over
+// a bin is second order in the 4.7% width)
+static const G4double dEnergyMin = 1. * keV;
+static const G4double dEnergyMax = 20. * MeV;
+static const G4int iBinsPerDecade = 50;
+static const G4double dMajorantMargin = 1.01;
+
+G4ThreadLocal Xenon1tWoodcockTracking *Xenon1tWoodcockTracking::m_pInstance =
+    0;
+
+G4bool Xenon1tWoodcockTracking::m_bActive = false;
+G4String Xenon1tWoodcockTracking::m_hEnvelope =
+    "OuterCryostatReflectorLogicalVolume";
+G4String Xenon1tWoodcockTracking::m_hExcluded = "SS_InnerCryostat";
+Xenon1tWoodcockTrackingMessenger *Xenon1tWoodcockTracking::m_pMessenger = 0;
+
+Xenon1tWoodcockTracking *Xenon1tWoodcockTracking::GetInstance() {
+  if (!m_pInstance) m_pInstance = new Xenon1tWoodcockTracking();
+  return m_pInstance;
+}
+
+Xenon1tWoodcockTracking::Xenon1tWoodcockTracking() {
+  m_pModel = 0;
+  m_pExcluded = 0;
+
+  m_bTablesReady = false;
+  m_iPendingTrackId = -1;
+
+  m_dFlights = 0.;
+  m_dNullCollisions = 0.;
+  m_dRealCollisions = 0.;
+  m_dMajorantViolations = 0.;
+
+  // the settings and their commands exist once, on the master
+  if (!G4Threading::IsWorkerThread() && !m_pMessenger)
+    m_pMessenger = new Xenon1tWoodcockTrackingMessenger(this);
+}
+
+Xenon1tWoodcockTracking::~Xenon1tWoodcockTracking() {
+  if (G4Threading::IsWorkerThread()) return;
+  delete m_pMessenger;
+  m_pMessenger = 0;
+}
+
+void Xenon1tWoodcockTracking::ConstructRegion() {
+  if (!m_bActive) return;
+
+  G4LogicalVolume *pEnvelope =
+      G4LogicalVolumeStore::GetInstance()->GetVolume(m_hEnvelope);
+  if (!pEnvelope)
+    G4Exception("Xenon1tWoodcockTracking::ConstructRegion()", "Woodcock",
+                FatalException, ("No logical volume " + m_hEnvelope).c_str());
+
+  // an envelope that is already a region keeps it (and its cuts)
+  if (!pEnvelope->IsRootRegion()) {
+    G4Region *pRegion = new G4Region("WoodcockRegion");
+    pRegion->AddRootLogicalVolume(pEnvelope);
+  }
+
+  G4cout << "Xenon1tWoodcockTracking: gammas delta-tracked in " << m_hEnvelope
+         << " (region " << pEnvelope->GetRegion()->GetName()
+         << "), excluding " << m_hExcluded << G4endl;
+}
+
+void Xenon1tWoodcockTracking::ConstructModel() {
+  if (!m_bActive || m_pModel) return;
+
+  G4LogicalVolume *pEnvelope =
+      G4LogicalVolumeStore::GetInstance()->GetVolume(m_hEnvelope);
+  if (!pEnvelope || !pEnvelope->IsRootRegion())
+    G4Exception("Xenon1tWoodcockTracking::ConstructModel()", "Woodcock",
+                FatalException, ("No region on " + m_hEnvelope).c_str());
+
+  m_pModel = new Xenon1tWoodcockModel("Woodcock", pEnvelope->GetRegion());
+  m_bTablesReady = false;
+}
+
+void Xenon1tWoodcockTracking::BuildTables() {
+  // the world is known to the navigator only after construction, so the
+  // excluded volume is looked up at the first flight
+  m_pExcluded = Xenon1tGeometryUtilities::FindTarget(
+      m_hExcluded, "Xenon1tWoodcockTracking::BuildTables()",
+      "the whole envelope is delta-tracked", m_hWorldToExcluded);
+
+  m_hProcesses.clear();
+  G4ProcessVector *pProcesses =
+      G4Gamma::Definition()->GetProcessManager()->GetProcessList();
+  for (G4int i = 0; i < pProcesses->size(); i++) {
+    G4VEmProcess *pProcess = dynamic_cast<G4VEmProcess *>((*pProcesses)[i]);
+    if (pProcess) m_hProcesses.push_back(pProcess);
+  }
+  if (m_hProcesses.empty())
+    G4Exception("Xenon1tWoodcockTracking::BuildTables()", "Woodcock",
+                FatalException, "No electromagnetic processes for gammas");
+
+  m_hCouples.clear();
+  CollectCouples(G4LogicalVolumeStore::GetInstance()->GetVolume(m_hEnvelope));
+
+  // absorption edges of all the elements in the envelope
+  vector<G4double> hAbsorptionEdges;
+  for (size_t j = 0; j < m_hCouples.size(); j++) {
+    const G4ElementVector *pElements =
+        m_hCouples[j]->GetMaterial()->GetElementVector();
+    for (size_t k = 0; k < pElements->size(); k++) {
+      const G4int iZ = (*pElements)[k]->GetZasInt();
+      for (G4int l = 0; l < G4AtomicShells::GetNumberOfShells(iZ); l++)
+        hAbsorptionEdges.push_back(G4AtomicShells::GetBindingEnergy(iZ, l));
+    }
+  }
+  std::sort(hAbsorptionEdges.begin(), hAbsorptionEdges.end());
+
+  const G4int iBins =
+      (G4int)std::ceil(std::log10(dEnergyMax / dEnergyMin) * iBinsPerDecade);
+  m_hMajorant.assign(iBins, 0.);
+  for (G4int i = 0; i < iBins; i++) {
+    const G4double dLow =
+        dEnergyMin * std::pow(10., (G4double)i / iBinsPerDecade);
+    const G4double dHigh =
+        dEnergyMin * std::pow(10., (G4double)(i + 1) / iBinsPerDecade);
+    vector<G4double> hEnergies(1, dLow);
+    for (size_t j = 0; j < hAbsorptionEdges.size(); j++)
+      if (hAbsorptionEdges[j] > dLow && hAbsorptionEdges[j] < dHigh) {
+        hEnergies.push_back(hAbsorptionEdges[j] * (1. - 1e-6));
+        hEnergies.push_back(hAbsorptionEdges[j] * (1. + 1e-6));
+      }
+    hEnergies.push_back(dHigh);
+
+    for (size_t j = 0; j < m_hCouples.size(); j++) {
+      G4double dSum = 0.;
+      for (size_t k = 0; k < m_hProcesses.size(); k++) {
+        G4double dLargest = 0.;
+        for (size_t l = 0; l < hEnergies.size(); l++)
+          dLargest = std::max(dLargest,
+                              m_hProcesses[k]->CrossSectionPerVolume(
+                                  hEnergies[l], m_hCouples[j]));
+        dSum += dLargest;
+      }
+      m_hMajorant[i] = std::max(m_hMajorant[i], dMajorantMargin * dSum);
+    }
+  }
+
+  m_bTablesReady = true;
+
+  G4cout << "Xenon1tWoodcockTracking: majorant of " << m_hCouples.size()
+         << " materials, " << m_hProcesses.size() << " gamma processes, "
+         << "mean free path at 1 MeV " << 1. / GetMajorant(1. * MeV) / cm
+         << " cm" << G4endl;
+}
+
+void Xenon1tWoodcockTracking::CollectCouples(G4LogicalVolume *pVolume) {
+  const G4MaterialCutsCouple *pCouple = pVolume->GetMaterialCutsCouple();
+  if (pCouple &&
+      std::find(m_hCouples.begin(), m_hCouples.end(), pCouple) ==
+          m_hCouples.end())
+    m_hCouples.push_back(pCouple);
+
+  for (G4int i = 0; i < pVolume->GetNoDaughters(); i++) {
+    G4VPhysicalVolume *pDaughter = pVolume->GetDaughter(i);
+    if (pDaughter == m_pExcluded) continue;
+
+    // parameterised materials are not known in advance, take them all
+    if (pDaughter->IsParameterised()) {
+      const G4ProductionCutsTable *pTable =
+          G4ProductionCutsTable::GetProductionCutsTable();
+      for (size_t j = 0; j < pTable->GetTableSize(); j++) {
+        const G4MaterialCutsCouple *pAnyCouple =
+            pTable->GetMaterialCutsCouple(j);
+        if (std::find(m_hCouples.begin(), m_hCouples.end(), pAnyCouple) ==
+            m_hCouples.end())
+          m_hCouples.push_back(pAnyCouple);
+      }
+    }
+
+    CollectCouples(pDaughter->GetLogicalVolume());
+  }
+}
+
+G4bool Xenon1tWoodcockTracking::IsExcluded(const G4Track *pTrack) const {
+  if (!m_pExcluded) return false;
+
+  const G4VTouchable *pTouchable = pTrack->GetTouchable();
+  for (G4int i = 0; i <= pTouchable->GetHistoryDepth(); i++)
+    if (pTouchable->GetVolume(i) == m_pExcluded) return true;
+  return false;
+}
+
+G4double Xenon1tWoodcockTracking::GetDistanceToExcluded(
+    const G4ThreeVector &hPosition, const G4ThreeVector &hDirection) const {
+  if (!m_pExcluded) return kInfinity;
+
+  const G4ThreeVector hLocalPosition =
+      Xenon1tGeometryUtilities::ToWorld(m_hWorldToExcluded, hPosition);
+  const G4ThreeVector hLocalDirection =
+      m_hWorldToExcluded.getRotation() * hDirection;
+  return m_pExcluded->GetLogicalVolume()->GetSolid()->DistanceToIn(
+      hLocalPosition, hLocalDirection);
+}
+
+G4bool Xenon1tWoodcockTracking::IsInEnergyRange(G4double dEnergy) const {
+  return dEnergy >= dEnergyMin && dEnergy < dEnergyMax;
+}
+
+G4double Xenon1tWoodcockTracking::GetMajorant(G4double dEnergy) {
+  if (!m_bTablesReady) BuildTables();
+
+  G4int iBin =
+      (G4int)(std::log10(dEnergy / dEnergyMin) * iBinsPerDecade);
+  iBin = std::max(0, std::min(iBin, (G4int)m_hMajorant.size() - 1));
+  return m_hMajorant[iBin];
+}
+
+G4double Xenon1tWoodcockTracking::GetCrossSection(
+    G4double dEnergy, const G4MaterialCutsCouple *pCouple) {
+  G4double dCrossSection = 0.;
+  for (size_t i = 0; i < m_hProcesses.size(); i++)
+    dCrossSection += m_hProcesses[i]->CrossSectionPerVolume(dEnergy, pCouple);
+  return dCrossSection;
+}
+
+G4VEmProcess *Xenon1tWoodcockTracking::SelectProcess(
+    G4double dEnergy, const G4MaterialCutsCouple *pCouple) {
+  const G4double dRandom = G4UniformRand() * GetCrossSection(dEnergy, pCouple);
+
+  G4double dSum = 0.;
+  for (size_t i = 0; i < m_hProcesses.size(); i++) {
+    dSum += m_hProcesses[i]->CrossSectionPerVolume(dEnergy, pCouple);
+    if (dRandom < dSum) return m_hProcesses[i];
+  }
+  return m_hProcesses.back();
+}
+
+void Xenon1tWoodcockTracking::ResetInteractionLengths(const G4Track *pTrack) {
+  // the gamma processes do not see a flight. Left alone, they would subtract
+  // the flight length over the mean free path they had at its start (another
+  // material) from their interaction lengths left at the next step. Their
+  // StartTracking() clears the lengths left and the cached mean free path,
+  // so the next step samples new ones, which is exact for the memoryless
+  // distance to the next interaction
+  G4Track *pMutableTrack = const_cast<G4Track *>(pTrack);
+  for (size_t i = 0; i < m_hProcesses.size(); i++)
+    m_hProcesses[i]->StartTracking(pMutableTrack);
+}
+
+void Xenon1tWoodcockTracking::SetPendingCollision(
+    const G4Track *pTrack, const G4ThreeVector &hPosition) {
+  m_iPendingTrackId = pTrack->GetTrackID();
+  m_hPendingPosition = hPosition;
+}
+
+G4bool Xenon1tWoodcockTracking::IsPendingCollision(
+    const G4Track &hTrack) const {
+  // the position check drops a collision left over by a killed track
+  return hTrack.GetTrackID() == m_iPendingTrackId &&
+         (hTrack.GetPosition() - m_hPendingPosition).mag2() < 1e-6 * um * um;
+}
+
+void Xenon1tWoodcockTracking::CountFlight(G4int iNullCollisions,
+                                          G4bool bRealCollision) {
+  m_dFlights += 1.;
+  m_dNullCollisions += iNullCollisions;
+  if (bRealCollision) m_dRealCollisions += 1.;
+}
+
+void Xenon1tWoodcockTracking::PrintStatistics() const {
+  G4cout << "Xenon1tWoodcockTracking: " << m_dFlights << " flights, "
+         << m_dRealCollisions << " real collisions, " << m_dNullCollisions
+         << " null collisions";
+  if (m_dFlights > 0.)
+    G4cout << " (" << m_dNullCollisions / m_dFlights << " per flight)";
+  G4cout << G4endl;
+
+  if (m_dMajorantViolations > 0.)
+    G4cout << "Xenon1tWoodcockTracking: majorant below the cross-section at "
+           << m_dMajorantViolations
+           << " collisions, the flights there are biased: raise "
+              "dMajorantMargin" << G4endl;
+}
@@ -0,0 +1,121 @@
+#ifndef __XENON1TWOODCOCKTRACKING_H__
+#define __XENON1TWOODCOCKTRACKING_H__
+
+#include <G4ThreeVector.hh>
+#include <G4Transform3D.hh>
+#include <globals.hh>
+
+#include <vector>
+
+using std::vector;
+
+class Xenon1tWoodcockModel;
+class Xenon1tWoodcockTrackingMessenger;
+class G4LogicalVolume;
+class G4MaterialCutsCouple;
+class G4Region;
+class G4Track;
+class G4VEmProcess;
+class G4VPhysicalVolume;
+
+// Woodcock (delta) tracking of gammas through the shields around the inner
+// cryostat. Inside the envelope volume (by default the outer cryostat
+// reflector, i.e. water layer, outer cryostat, vacuum and flanges) gammas
+// fly with the majorant of the total cross-section of all the materials in
+// it: at every tentative collision the material is located and the
+// collision is real with probability sigma(material) / sigma_majorant,
+// otherwise the gamma flies on. No boundary between water, foils, steel and
+// vacuum is ever stepped on; a flight ends at a real collision, at the
+// surface of the envelope or at the surface of the excluded volume (by
+// default the inner cryostat, tracked normally down to the xenon).
+//
+// Flights are done by a fast simulation model on the envelope, which
+// decides whether a collision is real, and real collisions by
+// Xenon1tWoodcockProcess, which hands them to the gamma process (phot,
+// compt, conv, Rayl) chosen by its cross-section. Both use the physics
+// tables of the run, and the gamma processes sample new interaction lengths
+// after every flight, so the result is the one of normal tracking; only the
+// number of steps changes (python_scripts/woodcock_study.py checks it).
+//
+// One instance per thread for the model, tables, pending collisions and
+// statistics; the settings are shared by all threads, made on the master in
+// PreInit (the commands exist on the master only) and read by the workers
+// when they build their model in ConstructSDandField(). The region is
+// shared.
+//
+// The physics list has to register G4FastSimulationManagerProcess and
+// Xenon1tWoodcockProcess for gammas.
+
+class Xenon1tWoodcockTracking {
+ public:
+  static Xenon1tWoodcockTracking *GetInstance();
+  ~Xenon1tWoodcockTracking();
+
+  G4bool IsActive() const { return m_bActive; }
+  void SetActive(G4bool bActive) { m_bActive = bActive; }
+  void SetEnvelope(const G4String &hEnvelope) { m_hEnvelope = hEnvelope; }
+  void SetExcluded(const G4String &hExcluded) { m_hExcluded = hExcluded; }
+
+  // region from Construct() (master), model from ConstructSDandField()
+  // (every thread)
+  void ConstructRegion();
+  void ConstructModel();
+  G4bool HasModel() const { return m_pModel != 0; }
+
+  G4bool IsExcluded(const G4Track *pTrack) const;
+  G4double GetDistanceToExcluded(const G4ThreeVector &hPosition,
+                                 const G4ThreeVector &hDirection) const;
+
+  G4bool IsInEnergyRange(G4double dEnergy) const;
+  G4double GetMajorant(G4double dEnergy);
+  G4double GetCrossSection(G4double dEnergy,
+                           const G4MaterialCutsCouple *pCouple);
+  // real gamma process for a collision, by partial cross-sections
+  G4VEmProcess *SelectProcess(G4double dEnergy,
+                              const G4MaterialCutsCouple *pCouple);
+  // after every flight, for the gamma processes to sample new interaction
+  // lengths at the next step
+  void ResetInteractionLengths(const G4Track *pTrack);
+
+  // collision accepted by the model, done by the process at the next step
+  void SetPendingCollision(const G4Track *pTrack,
+                           const G4ThreeVector &hPosition);
+  G4bool IsPendingCollision(const G4Track &hTrack) const;
+  void ClearPendingCollision() { m_iPendingTrackId = -1; }
+
+  void CountFlight(G4int iNullCollisions, G4bool bRealCollision);
+  void CountMajorantViolation() { m_dMajorantViolations += 1.; }
+  void PrintStatistics() const;
+
+ private:
+  Xenon1tWoodcockTracking();
+
+  void BuildTables();
+  void CollectCouples(G4LogicalVolume *pVolume);
+
+  static G4ThreadLocal Xenon1tWoodcockTracking *m_pInstance;
+
+  static G4bool m_bActive;
+  static G4String m_hEnvelope;
+  static G4String m_hExcluded;
+  static Xenon1tWoodcockTrackingMessenger *m_pMessenger;
+
+  Xenon1tWoodcockModel *m_pModel;
+  G4VPhysicalVolume *m_pExcluded;
+  G4Transform3D m_hWorldToExcluded;
+
+  G4bool m_bTablesReady;
+  vector<G4VEmProcess *> m_hProcesses;
+  vector<const G4MaterialCutsCouple *> m_hCouples;
+  vector<G4double> m_hMajorant;
+
+  G4int m_iPendingTrackId;
+  G4ThreeVector m_hPendingPosition;
+
+  G4double m_dFlights;
+  G4double m_dNullCollisions;
+  G4double m_dRealCollisions;
+  G4double m_dMajorantViolations;
+};
+
+#endif
@@ -0,0 +1,61 @@
+// XENON Header Files
+#include "Xenon1tWoodcockTrackingMessenger.hh"
+#include "Xenon1tWoodcockTracking.hh"
+
+// G4 Header Files
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+
+Xenon1tWoodcockTrackingMessenger::Xenon1tWoodcockTrackingMessenger(
+    Xenon1tWoodcockTracking *pTracking)
+    : m_pTracking(pTracking) {
+  // the settings are shared by all threads, the commands stay on the master
+  m_pWoodcockDir = new G4UIdirectory("/Xe/woodcock/", false);
+  m_pWoodcockDir->SetGuidance("Woodcock tracking of gammas in the shields.");
+
+  m_pActiveCmd = new G4UIcmdWithABool("/Xe/woodcock/setActive", this);
+  m_pActiveCmd->SetGuidance("Delta-track gammas in the envelope volume.");
+  m_pActiveCmd->SetParameterName("active", false);
+  m_pActiveCmd->AvailableForStates(G4State_PreInit);
+
+  m_pEnvelopeCmd = new G4UIcmdWithAString("/Xe/woodcock/envelope", this);
+  m_pEnvelopeCmd->SetGuidance("Logical volume of the region "
+                              "(OuterCryostatReflectorLogicalVolume).");
+  m_pEnvelopeCmd->SetParameterName("envelope", false);
+  m_pEnvelopeCmd->AvailableForStates(G4State_PreInit);
+
+  m_pExcludedCmd = new G4UIcmdWithAString("/Xe/woodcock/exclude", this);
+  m_pExcludedCmd->SetGuidance("Physical volume inside the envelope tracked "
+                              "normally (SS_InnerCryostat).");
+  m_pExcludedCmd->SetParameterName("volume", false);
+  m_pExcludedCmd->AvailableForStates(G4State_PreInit);
+
+  m_pPrintCmd = new G4UIcmdWithoutParameter("/Xe/woodcock/print", this);
+  m_pPrintCmd->SetGuidance("Print flights and collisions so far (master "
+                           "thread, the workers print theirs at the end of "
+                           "the run).");
+  m_pPrintCmd->AvailableForStates(G4State_Idle);
+}
+
+Xenon1tWoodcockTrackingMessenger::~Xenon1tWoodcockTrackingMessenger() {
+  delete m_pActiveCmd;
+  delete m_pEnvelopeCmd;
+  delete m_pExcludedCmd;
+  delete m_pPrintCmd;
+  delete m_pWoodcockDir;
+}
+
+void Xenon1tWoodcockTrackingMessenger::SetNewValue(G4UIcommand *pUIcommand,
+                                                   G4String hNewValue) {
+  if (pUIcommand == m_pActiveCmd)
+    m_pTracking->SetActive(m_pActiveCmd->GetNewBoolValue(hNewValue));
+
+  if (pUIcommand == m_pEnvelopeCmd) m_pTracking->SetEnvelope(hNewValue);
+
+  if (pUIcommand == m_pExcludedCmd) m_pTracking->SetExcluded(hNewValue);
+
+  if (pUIcommand == m_pPrintCmd) m_pTracking->PrintStatistics();
+}
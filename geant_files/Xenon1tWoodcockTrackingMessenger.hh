@@ -0,0 +1,31 @@
+#ifndef __XENON1TWOODCOCKTRACKINGMESSENGER_H__
+#define __XENON1TWOODCOCKTRACKINGMESSENGER_H__
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class Xenon1tWoodcockTracking;
+class G4UIcommand;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class Xenon1tWoodcockTrackingMessenger : public G4UImessenger {
+ public:
+  Xenon1tWoodcockTrackingMessenger(Xenon1tWoodcockTracking *pTracking);
+  ~Xenon1tWoodcockTrackingMessenger();
+
+  void SetNewValue(G4UIcommand *pUIcommand, G4String hNewValue);
+
+ private:
+  Xenon1tWoodcockTracking *m_pTracking;
+
+  G4UIdirectory *m_pWoodcockDir;
+  G4UIcmdWithABool *m_pActiveCmd;
+  G4UIcmdWithAString *m_pEnvelopeCmd;
+  G4UIcmdWithAString *m_pExcludedCmd;
+  G4UIcmdWithoutParameter *m_pPrintCmd;
+};
+
+#endif
@@ -272,10 +272,11 @@ void XenonNtTPC::DefineGeometryParametersNT(Xenon1tDetectorConstruction *det) {
          * GetGeometryParameterNT("GateRingTopToAnodeRingBot");
 }
 
-G4double XenonNtTPC::GetGeometryParameterNT(const char *szParameterNT) {
-  if (m_hGeometryParametersNT.find(szParameterNT) !=
-      m_hGeometryParametersNT.end()) {
-    return m_hGeometryParametersNT[szParameterNT];
+G4double XenonNtTPC::GetGeometryParameterNT(const char *szParameterNT) const {
+  map<G4String, G4double>::const_iterator pIt =
+      m_hGeometryParametersNT.find(szParameterNT);
+  if (pIt != m_hGeometryParametersNT.end()) {
+    return pIt->second;
   } else {
     G4cout << "----> Parameter " << szParameterNT << " is not defined!!!!!"
            << G4endl;
@@ -297,13 +298,7 @@ G4VPhysicalVolume *XenonNtTPC::ConstructTPC(Xenon1tDetectorConstruction *det) {
 
   ConstructTopTPC();
 
-  //_____ xenon sensitivity _____
-  G4SDManager *pSDManager = G4SDManager::GetSDMpointer();
-  Xenon1tLXeSensitiveDetector *pLXeSD =
-      new Xenon1tLXeSensitiveDetector("Xenon1t/LXeSD");
-  pSDManager->AddNewDetector(pLXeSD);
-  m_pLXeLogicalVolume->SetSensitiveDetector(pLXeSD);
-  m_pGXeLogicalVolume->SetSensitiveDetector(pLXeSD);
+  // xenon sensitivity: Xenon1tDetectorConstruction::ConstructSDandField()
 
   if (iVerbosityLevel >= 1)
     G4cout << "XenonNtTPC::Construct() TPC " << G4endl;
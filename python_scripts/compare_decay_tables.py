@@ -0,0 +1,122 @@
+#!/usr/bin/python
+#
+# Xenon spectrum of a decay-table run (/xe/gun/decay/segment <name>) against
+# the /xe/gun/ion run of the same segment, both per decay of the segment
+# parent, to check a table (decay_tables/<name>.dat) against the Geant4 decay
+# data of the campaign. Both runs use the same geometry, component and
+# physics list; the ion run is the usual make_macros.py macro of the segment
+# (e.g. /xe/gun/ion 92 238 0 0 with /grdm/nucleusLimits 238 230 92 90 for
+# U238), the table run replaces the ion by
+#   /xe/gun/decay/segment <name>
+#   /xe/gun/decay/sampling activity
+#
+# usage: python compare_decay_tables.py <table.dat> <table run files...>
+#        -- <ion run files...>
+#
+# The deposits of an event are split into decays where they are more than
+# WINDOW apart, which takes the members of the ion run apart (the table run
+# has one decay per event). Bi212->Po212 (0.3 us) is mostly split as well,
+# the few Po212 decays within WINDOW of their parent move into the sum
+# peak. Every table-run event has the weight sum(A_member) / A_parent of
+# activity sampling, every ion-run event counts once. Per bin the two rates,
+# their ratio and pull are printed, then chi2/ndf over the filled bins.
+#
+# Th232: the Th232 macro of make_macros.py stops at nucleusLimits 232 228
+# 90 88, which lets Th228 decay as well; compare Th232.dat against an ion run
+# with /grdm/nucleusLimits 232 228 90 89 (Th228 is the Th228.dat segment).
+
+import sys
+
+import numpy as np
+
+##### INPUT PARAMETER #####
+
+TREE = "events/events"
+DEPOSIT_BRANCHES = ["time", "ed"]    #ns, keV
+WINDOW = 10.                         #ns
+BINS = np.linspace(0., 3000., 301)   #keV
+MIN_ENERGY = 0.                      #keV, decays below are not counted
+##### ##### #####
+
+
+def table_weight(file_name):
+    #sum of the member activities over the parent activity
+    activities = []
+    for line in open(file_name):
+        tokens = line.split("#")[0].split()
+        if tokens and tokens[0] == "nuclide":
+            activities.append(float(tokens[2]) if len(tokens) > 2 else 1.)
+    return sum(activities)
+
+
+def decay_energies(file_names):
+    #(energies of the decays with a deposit, number of events)
+    import uproot
+    energies = []
+    events = 0
+    for file_name in file_names:
+        for chunk in uproot.iterate(file_name + ":" + TREE, DEPOSIT_BRANCHES,
+                                    library="np"):
+            for times, deposits in zip(chunk["time"], chunk["ed"]):
+                events += 1
+                if len(times) == 0:
+                    continue
+                order = np.argsort(times)
+                times = times[order]
+                deposits = deposits[order]
+                starts = np.concatenate(
+                    ([0], np.nonzero(np.diff(times) > WINDOW)[0] + 1))
+                energies.extend(np.add.reduceat(deposits, starts))
+    energies = np.array(energies)
+    return energies[energies > MIN_ENERGY], events
+
+
+def main():
+    if "--" not in sys.argv or sys.argv.index("--") < 3:
+        print("usage: python compare_decay_tables.py <table.dat> "
+              "<table run files...> -- <ion run files...>")
+        sys.exit(1)
+
+    split = sys.argv.index("--")
+    weight = table_weight(sys.argv[1])
+    table_energies, table_events = decay_energies(sys.argv[2:split])
+    ion_energies, ion_events = decay_energies(sys.argv[split + 1:])
+    if table_events == 0 or ion_events == 0:
+        print("no events")
+        sys.exit(1)
+
+    #rates per parent decay and keV
+    widths = np.diff(BINS)
+    table_counts = np.histogram(table_energies, BINS)[0]
+    ion_counts = np.histogram(ion_energies, BINS)[0]
+    table_rate = weight * table_counts / float(table_events) / widths
+    table_error = weight * np.sqrt(table_counts) / float(table_events) / widths
+    ion_rate = ion_counts / float(ion_events) / widths
+    ion_error = np.sqrt(ion_counts) / float(ion_events) / widths
+
+    print("%s: %d table events (weight %.4g), %d ion events" %
+          (sys.argv[1], table_events, weight, ion_events))
+    print("%10s %10s %12s %12s %8s %8s" % ("E_low", "E_high", "table",
+                                           "ion", "ratio", "pull"))
+    chi2 = 0.
+    ndf = 0
+    for i in range(len(widths)):
+        if table_counts[i] == 0 and ion_counts[i] == 0:
+            continue
+        sigma = np.sqrt(table_error[i] ** 2 + ion_error[i] ** 2)
+        pull = (table_rate[i] - ion_rate[i]) / sigma
+        ratio = table_rate[i] / ion_rate[i] if ion_counts[i] else float("inf")
+        print("%10.1f %10.1f %12.4g %12.4g %8.3f %8.2f" %
+              (BINS[i], BINS[i + 1], table_rate[i], ion_rate[i], ratio, pull))
+        chi2 += pull ** 2
+        ndf += 1
+
+    print("total per parent decay: table %.4g, ion %.4g" %
+          (weight * len(table_energies) / float(table_events),
+           len(ion_energies) / float(ion_events)))
+    if ndf:
+        print("chi2/ndf = %.1f/%d" % (chi2, ndf))
+
+
+if __name__ == "__main__":
+    main()
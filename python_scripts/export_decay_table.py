@@ -0,0 +1,360 @@
+#!/usr/bin/python
+#
+# Decay table of a chain segment (decay_tables/<segment>.dat) from the data
+# of a Geant4 release: the decay branches of every member come from
+# G4RadioactiveDecay (G4RADIOACTIVEDATA/z<Z>.a<A>) and the gamma cascades of
+# the daughter levels from PhotonEvaporation (G4LEVELGAMMADATA/z<Z>.a<A>),
+# the same files /xe/gun/ion reads, so that a segment run follows its
+# /xe/gun/ion run (python_scripts/compare_decay_tables.py).
+#
+# usage: python export_decay_table.py <first> [last] > decay_tables/<name>.dat
+#   e.g. U238 Th230 (the U238 segment), Th232 Ac228, Ra226, Th228, U235
+#
+# The members are followed from <first> down to the stable end of the chain,
+# or down to <last> whose decays are the last ones in the table, and get
+# their activity relative to <first> in secular equilibrium. Branches into
+# members below MIN_ACTIVITY are not followed (printed on stderr).
+#
+# Every cascade path of a level is a decay record, with its probability from
+# the relative gamma intensities and the conversion coefficients: a
+# converted transition gives the conversion electron of the shell (K, L1-3,
+# M at the M1 binding, N+ at the transition energy) and, for K conversion,
+# the K-alpha1 x-ray. Other x-rays and Auger electrons are dropped, as are
+# the paths below MIN_PROBABILITY per decay (their cascade stops there).
+# Levels that are themselves parents in G4RadioactiveDecay (Pa234m) are
+# members of their own. Beta shapes are allowed except for UNIQUE_FORBIDDEN.
+#
+# Assumed file layouts (Geant4 10.3, RadioactiveDecay5.1 and
+# PhotonEvaporation4.3), the non-numeric flag columns are skipped:
+#   RadioactiveDecay   "P <excitation> <half-life>" opens a parent level,
+#                      "<mode> <0> <total %>" gives a mode total and
+#                      "<mode> <daughter level> <intensity> <Q>" a branch,
+#                      renormalised to the mode total as G4RadioactiveDecay
+#                      does; Q is the beta endpoint, or the alpha decay
+#                      energy shared with the recoil
+#   PhotonEvaporation  "<index> <energy> <half-life> <spin> <transitions>"
+#                      per level, then per transition "<final index>
+#                      <gamma energy> <relative intensity> <multipolarity>
+#                      <mixing ratio> <total ICC> [K L1 L2 L3 M1-M5 N+ ICC]"
+
+import os
+import sys
+
+##### INPUT PARAMETER #####
+
+RADIOACTIVE_DATA = os.environ.get("G4RADIOACTIVEDATA", "")
+LEVEL_DATA = os.environ.get("G4LEVELGAMMADATA", "")
+MIN_ACTIVITY = 1e-3        #relative to the first member
+MIN_PROBABILITY = 1e-5     #per decay
+LEVEL_TOLERANCE = 1.       #keV, daughter level of a branch
+UNIQUE_FORBIDDEN = ["K40"]
+##### ##### #####
+
+ELEMENTS = ["n", "H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na",
+            "Mg", "Al", "Si", "P", "S", "Cl", "Ar", "K", "Ca", "Sc", "Ti", "V",
+            "Cr", "Mn", "Fe", "Co", "Ni", "Cu", "Zn", "Ga", "Ge", "As", "Se",
+            "Br", "Kr", "Rb", "Sr", "Y", "Zr", "Nb", "Mo", "Tc", "Ru", "Rh",
+            "Pd", "Ag", "Cd", "In", "Sn", "Sb", "Te", "I", "Xe", "Cs", "Ba",
+            "La", "Ce", "Pr", "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho",
+            "Er", "Tm", "Yb", "Lu", "Hf", "Ta", "W", "Re", "Os", "Ir", "Pt",
+            "Au", "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac",
+            "Th", "Pa", "U"]
+
+#electron binding energies K, L1, L2, L3, M1 and K-alpha1 energy (keV) of
+#the daughters of the natural chains
+ATOMIC = {80: (83.10, 14.84, 14.21, 12.28, 3.56, 70.82),
+          81: (85.53, 15.35, 14.70, 12.66, 3.70, 72.87),
+          82: (88.00, 15.86, 15.20, 13.04, 3.85, 74.97),
+          83: (90.53, 16.39, 15.71, 13.42, 4.00, 77.11),
+          84: (93.11, 16.94, 16.24, 13.81, 4.15, 79.29),
+          85: (95.73, 17.49, 16.78, 14.21, 4.32, 81.52),
+          86: (98.40, 18.05, 17.34, 14.62, 4.48, 83.78),
+          87: (101.14, 18.64, 17.91, 15.03, 4.65, 86.11),
+          88: (103.92, 19.24, 18.48, 15.44, 4.82, 88.47),
+          89: (106.76, 19.84, 19.08, 15.87, 5.00, 90.88),
+          90: (109.65, 20.47, 19.69, 16.30, 5.18, 93.35),
+          91: (112.60, 21.10, 20.31, 16.73, 5.37, 95.87),
+          92: (115.61, 21.76, 20.95, 17.17, 5.55, 98.44),
+          }
+
+#daughter (dZ, dA) of the G4RadioactiveDecay modes
+MODES = {"Alpha": (-2, -4), "BetaMinus": (1, 0), "BetaPlus": (-1, 0),
+         "KshellEC": (-1, 0), "LshellEC": (-1, 0), "MshellEC": (-1, 0),
+         "NshellEC": (-1, 0), "IT": (0, 0)}
+
+
+def warn(message):
+    sys.stderr.write("export_decay_table: " + message + "\n")
+
+
+def numbers(tokens):
+    values = []
+    for token in tokens:
+        try:
+            values.append(float(token))
+        except ValueError:
+            pass
+    return values
+
+
+def atomic(z):
+    #binding energies and K-alpha1, Moseley-type estimates outside the table
+    if z in ATOMIC:
+        return ATOMIC[z]
+    warn("no binding energies for Z = %d, using estimates" % z)
+    k = 0.0136 * (z - 1) ** 2
+    l = 0.0034 * (z - 5) ** 2
+    ATOMIC[z] = (k, l, l, l, 0.2 * l, 0.75 * k)
+    return ATOMIC[z]
+
+
+def parse_name(name):
+    #"Pa234m" -> (91, 234, True)
+    symbol = name.rstrip("0123456789m")
+    mass = name[len(symbol):].rstrip("m")
+    if symbol not in ELEMENTS or not mass:
+        raise ValueError("cannot parse nuclide " + name)
+    return ELEMENTS.index(symbol), int(mass), name.endswith("m")
+
+
+def nuclide_name(z, a, level):
+    return "%s%d%s" % (ELEMENTS[z], a, "m" if level > 0. else "")
+
+
+def read_parents(z, a):
+    #[(excitation, {mode: total}, [(mode, daughter level, intensity, Q)])]
+    path = os.path.join(RADIOACTIVE_DATA, "z%d.a%d" % (z, a))
+    if not os.path.exists(path):
+        return []
+    parents = []
+    for line in open(path):
+        tokens = line.split("#")[0].split()
+        if not tokens:
+            continue
+        if tokens[0] == "P":
+            parents.append((numbers(tokens[1:])[0], {}, []))
+            continue
+        if not parents or tokens[0] not in MODES:
+            if parents:
+                warn("%s: mode %s not followed" % (path, tokens[0]))
+            continue
+        values = numbers(tokens[1:])
+        if len(values) == 2:
+            parents[-1][1][tokens[0]] = values[1]
+        elif len(values) >= 3:
+            parents[-1][2].append((tokens[0], values[0], values[1],
+                                   values[2]))
+    return parents
+
+
+def find_parent(z, a, level):
+    for parent in read_parents(z, a):
+        if abs(parent[0] - level) < LEVEL_TOLERANCE:
+            return parent
+    return None
+
+
+def read_branches(z, a, level):
+    #[(mode, daughter level, probability, Q)], empty if stable
+    parent = find_parent(z, a, level)
+    if parent is None:
+        return []
+    excitation, totals, branches = parent
+    sums = {}
+    for mode, daughter_level, intensity, q in branches:
+        sums[mode] = sums.get(mode, 0.) + intensity
+    result = []
+    for mode, daughter_level, intensity, q in branches:
+        total = totals.get(mode, sums[mode])
+        if sums[mode] > 0. and intensity > 0.:
+            result.append((mode, daughter_level,
+                           1e-2 * intensity * total / sums[mode], q))
+    return result
+
+
+LEVELS = {}
+
+
+def read_levels(z, a):
+    #{index: (energy, [(final index, gamma energy, intensity, alpha, icc)])}
+    if (z, a) in LEVELS:
+        return LEVELS[(z, a)]
+    levels = {}
+    path = os.path.join(LEVEL_DATA, "z%d.a%d" % (z, a))
+    if os.path.exists(path):
+        lines = [line.split("#")[0] for line in open(path)]
+        lines = iter([line for line in lines if line.strip()])
+        for line in lines:
+            values = numbers(line.split())
+            transitions = []
+            for i in range(int(values[-1])):
+                t = numbers(next(lines).split())
+                alpha = t[5] if len(t) > 5 else 0.
+                icc = t[6:16] if len(t) >= 16 else []
+                transitions.append((int(t[0]), t[1], t[2], alpha, icc))
+            levels[int(values[0])] = (values[1], transitions)
+    else:
+        warn("no level data for Z = %d, A = %d" % (z, a))
+    LEVELS[(z, a)] = levels
+    return levels
+
+
+def find_level(levels, energy):
+    best = None
+    for index, level in levels.items():
+        if abs(level[0] - energy) < LEVEL_TOLERANCE and (
+                best is None or
+                abs(level[0] - energy) < abs(levels[best][0] - energy)):
+            best = index
+    return best
+
+
+def cascades(z, a, index, probability, emissions, records, isomers):
+    #all the de-excitation paths of a level, down to the ground state or to
+    #an isomer that decays on its own
+    levels = read_levels(z, a)
+    energy, transitions = levels[index]
+    if energy > 0. and find_parent(z, a, energy) is not None:
+        isomers.append((energy, probability))
+        records.append((probability, emissions))
+        return
+    total = sum(t[2] * (1. + t[3]) for t in transitions)
+    if not transitions or total <= 0. or probability < MIN_PROBABILITY:
+        records.append((probability, emissions))
+        return
+
+    binding = atomic(z)
+    for final, egamma, intensity, alpha, icc in transitions:
+        p = probability * intensity * (1. + alpha) / total
+        cascades(z, a, final, p / (1. + alpha),
+                 emissions + [("gamma", egamma)], records, isomers)
+        if alpha <= 0.:
+            continue
+        #K, L1, L2, L3, M1-M5, N+; L1 only if the shells are not given
+        shells = icc if sum(icc) > 0. else [0., alpha]
+        for shell, coefficient in enumerate(shells):
+            if coefficient <= 0.:
+                continue
+            if shell < 4:
+                electron = egamma - binding[shell]
+            elif shell < 9:
+                electron = egamma - binding[4]
+            else:
+                electron = egamma
+            if electron <= 0.:
+                continue
+            converted = [("electron", electron)]
+            if shell == 0:
+                converted.append(("xray", binding[5]))
+            cascades(z, a, final,
+                     p * alpha / (1. + alpha) * coefficient / sum(shells),
+                     emissions + converted, records, isomers)
+
+
+def decay_records(z, a, level):
+    #(records, daughters) of one member, records as (probability, emissions)
+    records = []
+    daughters = {}
+    for mode, daughter_level, probability, q in read_branches(z, a, level):
+        dz, da = MODES[mode]
+        zd, ad = z + dz, a + da
+        name = nuclide_name(z, a, level)
+        if mode == "Alpha":
+            emissions = [("alpha", q * ad / a)]
+        elif mode == "BetaMinus":
+            emissions = [("beta", q, zd, name in UNIQUE_FORBIDDEN)]
+        elif mode == "BetaPlus":
+            emissions = [("positron", q, zd, name in UNIQUE_FORBIDDEN)]
+        elif mode == "KshellEC":
+            emissions = [("xray", atomic(zd)[5])]
+        else:
+            emissions = []
+
+        levels = read_levels(zd, ad)
+        index = find_level(levels, daughter_level) if levels else None
+        isomers = []
+        if index is None:
+            if daughter_level > 0.:
+                warn("%s: no level at %.2f keV in Z = %d, A = %d" %
+                     (name, daughter_level, zd, ad))
+            records.append((probability, emissions))
+        else:
+            cascades(zd, ad, index, probability, emissions, records, isomers)
+
+        #the part that ends in an isomer decays as that isomer
+        ground = probability - sum(p for energy, p in isomers)
+        for energy, p in isomers:
+            daughter = (zd, ad, energy)
+            daughters[daughter] = daughters.get(daughter, 0.) + p
+        daughter = (zd, ad, 0.)
+        daughters[daughter] = daughters.get(daughter, 0.) + ground
+    return records, daughters
+
+
+def merge(records):
+    #same emissions in one record, most probable first
+    merged = {}
+    for probability, emissions in records:
+        key = tuple(tuple(round(x, 3) if isinstance(x, float) else x
+                          for x in emission) for emission in emissions)
+        merged[key] = merged.get(key, 0.) + probability
+    return sorted([(p, list(key)) for key, p in merged.items()],
+                  key=lambda record: -record[0])
+
+
+def format_emission(emission):
+    if emission[0] in ("beta", "positron"):
+        return "%s %.2f %d%s" % (emission[0], emission[1], emission[2],
+                                 " 1u" if emission[3] else "")
+    return "%s %.3f" % emission
+
+
+def main():
+    if len(sys.argv) < 2 or not RADIOACTIVE_DATA or not LEVEL_DATA:
+        print("usage: python export_decay_table.py <first> [last] "
+              "(with G4RADIOACTIVEDATA and G4LEVELGAMMADATA set)")
+        sys.exit(1)
+
+    first = parse_name(sys.argv[1])
+    last = parse_name(sys.argv[2]) if len(sys.argv) > 2 else None
+    #decays go down in A, or up in Z at the same A, or down in excitation
+    level = 0.
+    if first[2]:
+        level = min(p[0] for p in read_parents(first[0], first[1])
+                    if p[0] > 0.)
+    pending = {(first[0], first[1], level): 1.}
+
+    print("# %s, exported by python_scripts/export_decay_table.py from" %
+          " - ".join(sys.argv[1:]))
+    print("# %s and %s, intensities per 100 decays" %
+          (RADIOACTIVE_DATA, LEVEL_DATA))
+    members = 0
+    while pending:
+        member = min(pending, key=lambda m: (-m[1], m[0], -m[2]))
+        activity = pending.pop(member)
+        z, a, level = member
+        name = nuclide_name(z, a, level)
+        if activity < MIN_ACTIVITY:
+            warn("%s (activity %.3g) not followed" % (name, activity))
+            continue
+        records, daughters = decay_records(z, a, level)
+        if not records:
+            continue
+
+        print("nuclide %s %.6g" % (name, activity) if members else
+              "nuclide %s" % name)
+        members += 1
+        for probability, emissions in merge(records):
+            print("decay %.6g" % (100. * probability))
+            for emission in emissions:
+                print(format_emission(emission))
+
+        if last is not None and (z, a, level > 0.) == last:
+            continue
+        for daughter, probability in daughters.items():
+            pending[daughter] = pending.get(daughter, 0.) + \
+                activity * probability
+
+
+if __name__ == "__main__":
+    main()
@@ -23,6 +23,27 @@ material_array = ["SS_OuterCryostat",
                 "Copper_BottomPmtPlate",
                 ]
 
+#volumes simulated together with a component (/xe/gun/confine, and one
+#adjoint scoring component per entry), the component itself otherwise
+confine_array = {"PmtTpc": "PmtTpc*",
+                "Copper_FieldGuard_": "Copper_FieldGuard_*",
+                "Copper_FieldShaperRing_": "Copper_FieldShaperRing_*",
+                "SS_AnodeRing": "SS_AnodeRing SS_TopMeshRing SS_CathodeRing SS_BottomMeshRing",
+                "Teflon_Pillar_": "Teflon_Pillar_* GXeTeflon_TopElectrodesFrame Teflon_TopElectrodesFrame",
+                "Copper_BottomPmtPlate": "Copper_BottomPmtPlate Copper_TopPmtPlate",
+                "Copper_TopRing": "Copper_TopRing Copper_LowerRing",
+                }
+
+#sub-components simulated on their own, declared in Xenon1tDetectorConstruction
+#(same cuts as divide_outercryo / divide_innercryo in the notebooks)
+subregion_array = {"OuterCryostatShell": "SS_OuterCryostat",
+                "OuterCryostatElongation": "SS_OuterCryostat",
+                "OuterCryostatFlange1": "SS_OuterCryostat",
+                "OuterCryostatFlange2": "SS_OuterCryostat",
+                "OuterCryostatFlange3": "SS_OuterCryostat",
+                }
+#material_array = list(subregion_array)
+
 isotope_array = ["U238",
                 "Co60",
                 "K40",
@@ -36,13 +57,165 @@ isotope_array = ["U238",
 #isotope_array =[ "geantinos"] 
 
         
+#one job set per chain: pre-tabulated decays (decay_tables/<ISOTOPE>.dat,
+#the whole chain in secular equilibrium) instead of /xe/gun/ion
+DECAY_TABLES = False
+DECAY_TABLE_DIRECTORY = "decay_tables"
+if DECAY_TABLES:
+    #U238Chain and Th232Chain are read from their segments (U238 + Ra226,
+    #Th232 + Th228, the split of the /xe/gun/ion macros); broken equilibrium
+    #goes in the macro with /xe/gun/decay/activity <nuclide> <A>, or in the
+    #segment lines of the chain table
+    isotope_array = ["U238Chain", "U235", "Th232Chain", "K40", "Co60",
+                     "Cs137"]
+    #a missing table would only show up as a fatal exception in the job
+    for ISOTOPE_STRING in isotope_array:
+        TABLES = [ISOTOPE_STRING]
+        TABLE_NAME = os.path.join(DECAY_TABLE_DIRECTORY, ISOTOPE_STRING + ".dat")
+        if os.path.exists(TABLE_NAME):
+            TABLES += [line.split()[1] for line in open(TABLE_NAME)
+                       if line.split()[:1] == ["segment"]]
+        for TABLE_STRING in TABLES:
+            if not os.path.exists(os.path.join(DECAY_TABLE_DIRECTORY,
+                                               TABLE_STRING + ".dat")):
+                sys.exit("no decay table " + TABLE_STRING + ".dat in " + DECAY_TABLE_DIRECTORY)
+
+#aim the decay-table gammas at SS_InnerCryostat (weighted events, outer
+#components only: the analysis must then use the event weights)
+ANGULAR_BIAS = False
+
+#geometry splitting/roulette toward the TPC (G4ImportanceBiasing on gammas);
+#validate on one component against an unbiased run before production
+IMPORTANCE_BIASING = False
+importance_array = [("OuterCryostatReflector", 2),
+                    ("WaterLayer", 2),
+                    ("SS_OuterCryostat", 4),
+                    ("OuterCryostatVacuum", 8),
+                    ("SS_InnerCryostat", 16),
+                    ("LXe", 32),
+                    ("GXe", 32),
+                    ]
+
+#plate-out: vertices on the LXe-facing surfaces of the component instead of
+#its volume (with DECAY_TABLES, isotope "Pb210" runs Pb210/Bi210/Po210)
+SURFACE_SOURCE = False
+IMPLANTATION_DEPTH = "50 nm"
+
+#scrambled Sobol vertices/directions, one scramble per array task
+#(python_scripts/qmc_study.py for the comparison with pseudo-random runs)
+QMC = False
+
+#force the first gamma interaction in the xenon (weighted hits)
+FORCED_COLLISION = False
+
+#delta tracking of gammas from the reflector down to the inner cryostat
+#(fewer boundary steps for the outer components, same physics)
+#validated against a run without it with woodcock_study.py
+WOODCOCK = False
+
+#production cuts per detector region (Xenon1tRegions: 0.1 mm in the xenon
+#up to 5 cm in the rock) instead of the single cut of the physics list;
+#check that the FV ER spectra do not change before using it in production
+REGIONS = False
+
+#one reverse Monte Carlo macro for the whole component list: adjoint gammas
+#and electrons from the LXe surface out to the outermost component, scored
+#per component and energy (Xenon1tAdjointScorer)
+ADJOINT = False
+adjoint_ext_volume = "OuterCryostatReflector"
+
+#one activity-weighted macro for a whole contamination table instead of one
+#macro per material and isotope (every event is one decay, N events are
+#N / rate seconds, the rate is printed by /xe/gun/mixed/print)
+MIXED = False
+mixed_table = "contamination_tables/cryostat.dat"
+#absolute decay times at the rate of the table, one Poisson stream per array
+#task (merge and pile-up with python_scripts/merge_stream.py); the number of
+#streams is the number of tasks of the array, from SLURM_ARRAY_TASK_COUNT
+TIME_STREAM = False
+
+#fork worker processes after initialisation (one file per worker, _p<i>),
+#for nodes with several cores per task; 1 is a plain run
+FORK = False
+fork_workers = 4
+
+#one counter-based random stream per event, keyed by campaign (DATE_STRING),
+#component and isotope: array tasks are shards of one run (job.sh sets the
+#first event of each task) and any event can be replayed by its number
+COUNTER_RNG = False
+
+#checkpoint every checkpoint_interval events, a retried task (job.sh)
+#resumes from its last checkpoint and appends to its output
+CHECKPOINT = False
+checkpoint_interval = 5000
+
+#abort events that cannot be single scatters in the FV below 200 keV
+#(not with IMPORTANCE_BIASING or FORCED_COLLISION)
+EVENT_FILTER = False
+
+#stacking rules for secondaries that cannot reach the LXe (first match
+#applies: action particle volume emax eunit dmin dunit), deferred tracks are
+#simulated last and dropped if EVENT_FILTER rejected the event meanwhile
+STACKING_RULES = False
+stacking_rules = ["kill nu_* * inf keV 0 mm",
+                  "kill anti_nu_* * inf keV 0 mm",
+                  "kill nucleus SS_* inf keV 0 mm",
+                  "kill nucleus Copper_* inf keV 0 mm",
+                  "defer e- SS_* 3 MeV 5 mm",
+                  ]
+
+#stop tracks entering the lab air, concrete and rock from the water tank
+#(killed tracks are tallied, every kill_zone_audit-th event is simulated in
+#full to measure the deposits the kill zones ignore, 0 for none)
+KILL_ZONES = False
+kill_zone_audit = 1000
+
+#stop e-/e+ below 1 MeV in the steel, copper and PTFE whose range is shorter
+#than their distance to the xenon, depositing their energy on the spot
+RANGE_REJECTION = False
+
+#one LXe/GXe hit per cluster of steps within cluster_distance (dr dz, mm)
+#instead of one per step, well below the scatter separation of nSort
+CLUSTER_HITS = False
+cluster_distance = "1 1"
+
 EVENT_COUNT = 100000
 #EVENT_COUNT = 10 
 #POSTPONE_DECAY = ["true"]
 DATE_STRING = str(date.today())
 #DATE_STRING = "2019-11-07" 
+
+#commands that are only accepted before /run/initialize go in
+#macros/preinit_ER.mac, which executes preinit_macro first (job.sh runs it
+#instead of preinit_macro when it exists); the run_ER_*.mac macros are
+#executed after the initialisation
+preinit_macro = "/users/arocchetti/mc/macros/XENONnT/preinit_TPC.mac"
 ##### ##### #####
 
+PREINIT_STRING = ""
+if IMPORTANCE_BIASING:
+    PREINIT_STRING += "#IMPORTANCE BIASING" + '\n' + "/Xe/importance/setActive true" + '\n'
+    for VOLUME_STRING, IMPORTANCE in importance_array:
+        PREINIT_STRING += "/Xe/importance/set " + VOLUME_STRING + " " + str(IMPORTANCE) + '\n'
+    PREINIT_STRING += '\n'
+
+if FORCED_COLLISION:
+    PREINIT_STRING += "#FORCED COLLISION" + '\n' + "/Xe/forcedCollision/setActive true" + '\n' + '\n'
+
+if REGIONS:
+    PREINIT_STRING += "#PRODUCTION CUT REGIONS" + '\n' + "/Xe/regions/setActive true" + '\n' + '\n'
+
+if WOODCOCK:
+    PREINIT_STRING += "#WOODCOCK TRACKING" + '\n' + "/Xe/woodcock/setActive true" + '\n' + '\n'
+
+if PREINIT_STRING:
+    f = open("macros/preinit_ER.mac", "w")
+    f.write("/control/execute " + preinit_macro + '\n' + '\n' + PREINIT_STRING)
+    f.close()
+elif os.path.exists("macros/preinit_ER.mac"):
+    #a stale one would still be picked up by job.sh
+    os.remove("macros/preinit_ER.mac")
+
 for MATERIAL_STRING in material_array: 
     for ISOTOPE_STRING in isotope_array:
     
@@ -56,45 +229,98 @@ for MATERIAL_STRING in material_array:
 
         f.write("#VERBOSITY" +'\n' +  "/control/verbose 0" +'\n' + "/run/verbose 0" +'\n' +"/event/verbose 0" +'\n' +"/tracking/verbose 0" +'\n' + "/xe/gun/verbose 0" +'\n' +'\n')
         #f.write('/Xe/detector/verbose 2'+ '\n')
-        f.write("#SEED" +'\n' "/run/random/setRandomSeed 0" +'\n' +'\n')
+        if COUNTER_RNG:
+            f.write("#SEED" +'\n' + "/Xe/random/stream " + DATE_STRING + " " + MATERIAL_STRING + " " + ISOTOPE_STRING + '\n' + "/Xe/random/setActive true" + '\n' + '\n')
+        else:
+            f.write("#SEED" +'\n' "/run/random/setRandomSeed 0" +'\n' +'\n')
         f.write("# General source settings"  +'\n' +"/xe/gun/angtype  iso" +'\n' +"/xe/gun/type  Volume" +'\n' +"/xe/gun/shape  Cylinder" +'\n' +"/xe/gun/center  0. 0. -70. cm" +'\n' + "/xe/gun/radius 100. cm" + '\n' + "/xe/gun/halfz 170. cm" + '\n' + "/xe/gun/energy 0 keV"+ '\n' + "/xe/gun/particle ion" + '\n' + '\n')
  
-         #for the ones who want the i*
-        if ((MATERIAL_STRING == "PmtTpc") |
-           (MATERIAL_STRING == "Copper_FieldGuard_")|
-           (MATERIAL_STRING == "Copper_FieldShaperRing_")) :
-            f.write("/xe/gun/confine " + MATERIAL_STRING + "*" + '\n')
-
-        elif (MATERIAL_STRING == "SS_AnodeRing"):
-            # f.write("/xe/gun/confine " + MATERIAL_STRING + "*" + '\n')
-            f.write("/xe/gun/confine SS_AnodeRing SS_TopMeshRing SS_CathodeRing SS_BottomMeshRing" + "\n")
-            #print("----------------")
-      
-        elif (MATERIAL_STRING == "Teflon_Pillar_"):
-            f.write("/xe/gun/confine Teflon_Pillar_* GXeTeflon_TopElectrodesFrame Teflon_TopElectrodesFrame" + "\n")
-        
-        elif (MATERIAL_STRING == "Copper_BottomPmtPlate"):
-            f.write("/xe/gun/confine Copper_BottomPmtPlate Copper_TopPmtPlate" +"\n")
-
-        elif (MATERIAL_STRING == "Copper_TopRing"):
-            f.write("/xe/gun/confine Copper_TopRing Copper_LowerRing" + "\n")
+        if MATERIAL_STRING in subregion_array:
+            f.write("/xe/gun/confine " + subregion_array[MATERIAL_STRING] + '\n')
+            f.write("/Xe/subregion/confine " + MATERIAL_STRING + '\n')
         else:
-            f.write("/xe/gun/confine " + MATERIAL_STRING + '\n')
+            f.write("/xe/gun/confine " + confine_array.get(MATERIAL_STRING, MATERIAL_STRING) + '\n')
         
 	
-        if ISOTOPE_STRING == "Co60": {f.write("### Co60" +'\n' +"/xe/gun/ion 27 60 0 0" +'\n'+'\n')}
-        if ISOTOPE_STRING == "K40": {f.write("### K40" +'\n' +"/xe/gun/ion 19 40 0 0" +'\n'+'\n')}
-        if ISOTOPE_STRING == "Cs137": {f.write("### Cs137" +'\n' +"/xe/gun/ion 55 137 0 0" +'\n'+'\n')}
+        if DECAY_TABLES:
+            f.write("### " + ISOTOPE_STRING + " (decay tables)" + '\n' + "/xe/gun/decay/segment " + ISOTOPE_STRING + '\n' + '\n')
+            if ANGULAR_BIAS:
+                f.write("/xe/gun/bias/targetVolume SS_InnerCryostat" + '\n' + "/xe/gun/bias/isotropicFraction 0.05" + '\n' + "/xe/gun/bias/setActive true" + '\n' + '\n')
+        else:
+            if ISOTOPE_STRING == "Co60": {f.write("### Co60" +'\n' +"/xe/gun/ion 27 60 0 0" +'\n'+'\n')}
+            if ISOTOPE_STRING == "K40": {f.write("### K40" +'\n' +"/xe/gun/ion 19 40 0 0" +'\n'+'\n')}
+            if ISOTOPE_STRING == "Cs137": {f.write("### Cs137" +'\n' +"/xe/gun/ion 55 137 0 0" +'\n'+'\n')}
         
-        #splitted chain        
-        if ISOTOPE_STRING == "Th228": {f.write("### Th228->Pb208 (stable)" +'\n' +"/xe/gun/ion 90 228 0 0" +'\n'+'\n'+'\n')}
-        if ISOTOPE_STRING == "U238": {f.write("### U238->Th230 (incl.)" +'\n' +"/xe/gun/ion 92 238 0 0" +'\n' +"/grdm/nucleusLimits 238 230 92 90" +'\n'+'\n')}
-        if ISOTOPE_STRING == "Ra226": {f.write("### Ra226" +'\n' +"/xe/gun/ion 88 226 0 0" +'\n'+'\n')}
-        if ISOTOPE_STRING == "Th232": {f.write("### Th232->Ac228 (stable)" +'\n' +"/xe/gun/ion 90 232 0 0" +'\n'+"/grdm/nucleusLimits 232 228 90 88"+'\n')}
-        #if ISOTOPE_STRING == "U238Pb206": {f.write("### U238->Pb206 (stable)" +'\n' +"/xe/gun/ion 92 238 0 0" +'\n'+ "/grdm/nucleusLimits 238 206 92 80" + '\n' + '\n')}
-        if ISOTOPE_STRING == "U235": {f.write("### U235->Pb207 (stable)" +'\n' +"/xe/gun/ion 92 235 0 0" +'\n'+'\n')}
-        if ISOTOPE_STRING == "geantinos": {f.write("/xe/gun/energy 0 keV"+ '\n'+ "/xe/gun/particle geantino" + '\n')}
+            #splitted chain        
+            if ISOTOPE_STRING == "Th228": {f.write("### Th228->Pb208 (stable)" +'\n' +"/xe/gun/ion 90 228 0 0" +'\n'+'\n'+'\n')}
+            if ISOTOPE_STRING == "U238": {f.write("### U238->Th230 (incl.)" +'\n' +"/xe/gun/ion 92 238 0 0" +'\n' +"/grdm/nucleusLimits 238 230 92 90" +'\n'+'\n')}
+            if ISOTOPE_STRING == "Ra226": {f.write("### Ra226" +'\n' +"/xe/gun/ion 88 226 0 0" +'\n'+'\n')}
+            if ISOTOPE_STRING == "Th232": {f.write("### Th232->Ac228 (stable)" +'\n' +"/xe/gun/ion 90 232 0 0" +'\n'+"/grdm/nucleusLimits 232 228 90 88"+'\n')}
+            #if ISOTOPE_STRING == "U238Pb206": {f.write("### U238->Pb206 (stable)" +'\n' +"/xe/gun/ion 92 238 0 0" +'\n'+ "/grdm/nucleusLimits 238 206 92 80" + '\n' + '\n')}
+            if ISOTOPE_STRING == "U235": {f.write("### U235->Pb207 (stable)" +'\n' +"/xe/gun/ion 92 235 0 0" +'\n'+'\n')}
+            if ISOTOPE_STRING == "geantinos": {f.write("/xe/gun/energy 0 keV"+ '\n'+ "/xe/gun/particle geantino" + '\n')}
+
+        if SURFACE_SOURCE:
+            SURFACE_STRING = MATERIAL_STRING
+            if MATERIAL_STRING in ["PmtTpc", "Copper_FieldGuard_", "Copper_FieldShaperRing_", "Teflon_Pillar_"]:
+                SURFACE_STRING += "*"
+            f.write("#SURFACE SOURCE" + '\n' + "/xe/gun/surface/volume " + SURFACE_STRING + '\n' + "/xe/gun/surface/medium LXe" + '\n' + "/xe/gun/surface/depth " + IMPLANTATION_DEPTH + '\n' + "/xe/gun/surface/setActive true" + '\n' + '\n')
+
+        if QMC:
+            f.write("#QUASI-RANDOM SAMPLING" + '\n' + "/xe/gun/qmc/setActive true" + '\n' + '\n')
+
+        if EVENT_FILTER:
+            f.write("#EVENT FILTER" + '\n' + "/Xe/filter/maxEnergy 200 keV" + '\n' + "/Xe/filter/setActive true" + '\n' + '\n')
+
+        if STACKING_RULES:
+            f.write("#STACKING RULES" + '\n' + "/Xe/stacking/setActive true" + '\n')
+            for RULE in stacking_rules:
+                f.write("/Xe/stacking/rule " + RULE + '\n')
+            f.write('\n')
+
+        if KILL_ZONES:
+            f.write("#KILL ZONES" + '\n' + "/Xe/killZone/auditEvery " + str(kill_zone_audit) + '\n' + "/Xe/killZone/setActive true" + '\n' + '\n')
+
+        if RANGE_REJECTION:
+            f.write("#RANGE REJECTION" + '\n' + "/Xe/rangeRejection/setActive true" + '\n' + '\n')
+
+        if CLUSTER_HITS:
+            f.write("#HIT CLUSTERING" + '\n' + "/Xe/cluster/distance " + cluster_distance + " mm" + '\n' + "/Xe/cluster/setActive true" + '\n' + '\n')
+
+        if CHECKPOINT:
+            f.write("#CHECKPOINTS" + '\n' + "/Xe/checkpoint/setActive true" + '\n' + "/Xe/checkpoint/interval " + str(checkpoint_interval) + '\n' + "/Xe/checkpoint/resume true" + '\n' + '\n')
+
+        if FORK:
+            f.write("#WORKER PROCESSES" + '\n' + "/Xe/fork/workers " + str(fork_workers) + '\n' + "/Xe/fork/metadata " + "fork_" + MATERIAL_STRING + "_" + ISOTOPE_STRING + ".txt" + '\n' + '\n')
 
         f.write("#ADVANCED RUN OPTIONS" +'\n'  +  "/analysis/settings/setPMTdetails true" + '\n' + "/xe/Postponedecay true" + '\n' + "/run/forced/setVarianceReduction false" +'\n' + "/Xe/detector/setLXeScintillation false" +'\n' + "/run/writeEmpty true" +'\n' + "/Xe/detector/setGdLScintScintillation false")
         
         f.close()
+
+if ADJOINT:
+    f = open("macros/run_adjoint.mac", "w")
+    f.write("#VERBOSITY" +'\n' +  "/control/verbose 0" +'\n' + "/run/verbose 0" +'\n' +"/event/verbose 0" +'\n' +"/tracking/verbose 0" +'\n' +'\n')
+    f.write("#SEED" +'\n' "/run/random/setRandomSeed 0" +'\n' +'\n')
+    f.write("#ADJOINT SOURCES" + '\n' + "/adjoint/DefineAdjSourceOnExtSurfaceOfAVolume LXe" + '\n' + "/adjoint/DefineExtSourceOnExtSurfaceOfAVolume " + adjoint_ext_volume + '\n' + "/adjoint/SetAdjSourceEmin 1 keV" + '\n' + "/adjoint/SetAdjSourceEmax 3 MeV" + '\n' + "/adjoint/ConsiderAsPrimary gamma" + '\n' + "/adjoint/ConsiderAsPrimary e-" + '\n' + "/adjoint/NeglectAsPrimary proton" + '\n' + '\n')
+    f.write("#COMPONENT SCORING" + '\n' + "/Xe/adjoint/setActive true" + '\n' + "/Xe/adjoint/energyBinning 10 3000 300 keV" + '\n')
+    for MATERIAL_STRING in material_array:
+        f.write("/Xe/adjoint/component " + confine_array.get(MATERIAL_STRING, MATERIAL_STRING) + '\n')
+    f.write('\n' + "/adjoint/start_run " + str(EVENT_COUNT) + '\n')
+    f.close()
+
+if MIXED:
+    f = open("macros/run_mixed.mac", "w")
+    f.write("#VERBOSITY" +'\n' +  "/control/verbose 0" +'\n' + "/run/verbose 0" +'\n' +"/event/verbose 0" +'\n' +"/tracking/verbose 0" +'\n' +'\n')
+    if COUNTER_RNG:
+        f.write("#SEED" +'\n' + "/Xe/random/stream " + DATE_STRING + " mixed " + mixed_table.split("/")[-1] + '\n' + "/Xe/random/setActive true" + '\n' + '\n')
+    else:
+        f.write("#SEED" +'\n' "/run/random/setRandomSeed 0" +'\n' +'\n')
+    f.write("#MIXED SOURCE" + '\n' + "/xe/gun/mixed/directory decay_tables" + '\n' + "/xe/gun/mixed/table " + mixed_table + '\n' + '\n')
+    if TIME_STREAM:
+        f.write("#TIME STREAM" + '\n' + "/xe/gun/time/setActive true" + '\n' + "/xe/Postponedecay true" + '\n' + '\n')
+    if FORK:
+        f.write("#WORKER PROCESSES" + '\n' + "/Xe/fork/workers " + str(fork_workers) + '\n' + "/Xe/fork/metadata fork_mixed.txt" + '\n' + "/Xe/fork/beamOn " + str(EVENT_COUNT) + '\n')
+    else:
+        f.write("/run/beamOn " + str(EVENT_COUNT) + '\n')
+    f.write("/xe/gun/mixed/print" + '\n')
+    f.close()
@@ -0,0 +1,152 @@
+#!/usr/bin/python
+#
+# Time-ordered stream of the per-task outputs of a /xe/gun/time/ run, with
+# pile-up: the deposits of all tasks are put on one clock (start time of the
+# decay + time of the deposit) and deposits closer than WINDOW to the first
+# one of a record are summed into that record (energy, energy-weighted
+# position, number of decays). Bi214->Po214 and the other delayed daughters
+# of /xe/Postponedecay runs keep their Geant4 decay time and come out at the
+# right distance from their parent.
+#
+# usage: python merge_stream.py <output.csv> <window in ns> <task files...>
+#
+# Every task is a Poisson stream of rate R / streams and is time-ordered by
+# decay start, so the files are read chunk by chunk and merged k-way: a
+# deposit is released once the next decay of every file starts after it
+# (no later event can deposit earlier than it starts), and only the decays
+# that overlap in time are in memory.
+#
+# The tasks end at different times (same number of events, random
+# intervals), and after the end of one of them the merged stream is short of
+# its rate. The stream is cut at the earliest last decay of the tasks: later
+# decays and deposits are dropped, and the live time is that cut.
+
+import csv
+import heapq
+import itertools
+import sys
+
+##### INPUT PARAMETER #####
+
+TREE = "events/events"
+START_BRANCH = "tstart"            #s, Xenon1tEventInformation::GetStartTime
+DEPOSIT_BRANCHES = ["time", "ed", "xp", "yp", "zp"]   #ns, keV, mm
+CHUNK = "100 MB"
+##### ##### #####
+
+
+def end_time(file_name):
+    #start of the last decay of a task
+    import uproot
+    end = 0.
+    for chunk in uproot.iterate(file_name + ":" + TREE, [START_BRANCH],
+                                step_size=CHUNK, library="np"):
+        if len(chunk[START_BRANCH]):
+            end = max(end, float(chunk[START_BRANCH].max()))
+    return end
+
+
+def read_decays(file_name, task, cut):
+    #(start, task, event, deposits) per event up to the cut, deposits as
+    #(t, ed, x, y, z)
+    import uproot
+    branches = [START_BRANCH] + DEPOSIT_BRANCHES
+    event = 0
+    for chunk in uproot.iterate(file_name + ":" + TREE, branches,
+                                step_size=CHUNK, library="np"):
+        for i in range(len(chunk[START_BRANCH])):
+            start = float(chunk[START_BRANCH][i])
+            if start > cut:
+                return
+            deposits = [(start + 1e-9 * float(t), float(ed), float(x),
+                         float(y), float(z))
+                        for t, ed, x, y, z in zip(*[chunk[b][i]
+                                                    for b in DEPOSIT_BRANCHES])
+                        if ed > 0. and start + 1e-9 * float(t) <= cut]
+            yield start, task, event, deposits
+            event += 1
+
+
+def merge_deposits(streams):
+    #k-way merge of the decay streams into one time-ordered deposit stream
+    files = []
+    for stream in streams:
+        decay = next(stream, None)
+        if decay is not None:
+            heapq.heappush(files, (decay[0], decay[1], decay, stream))
+
+    counter = itertools.count()
+    pending = []
+    while files:
+        start, task, decay, stream = heapq.heappop(files)
+        for deposit in decay[3]:
+            heapq.heappush(pending, (deposit[0], next(counter), deposit,
+                                     (decay[1], decay[2])))
+        decay = next(stream, None)
+        if decay is not None:
+            if decay[0] < start:
+                raise ValueError("task %d is not time-ordered" % task)
+            heapq.heappush(files, (decay[0], decay[1], decay, stream))
+
+        watermark = files[0][0] if files else float("inf")
+        while pending and pending[0][0] < watermark:
+            t, _, deposit, source = heapq.heappop(pending)
+            yield deposit, source
+
+
+def pile_up(deposits, window):
+    #records of all the deposits within window (s) of the first one
+    record = None
+    for deposit, source in deposits:
+        t, ed, x, y, z = deposit
+        if record is not None and t - record["t"] > window:
+            yield record
+            record = None
+        if record is None:
+            record = {"t": t, "dt": 0., "ed": 0., "x": 0., "y": 0., "z": 0.,
+                      "ndeposits": 0, "sources": set()}
+        record["dt"] = t - record["t"]
+        record["ed"] += ed
+        record["x"] += ed * x
+        record["y"] += ed * y
+        record["z"] += ed * z
+        record["ndeposits"] += 1
+        record["sources"].add(source)
+    if record is not None:
+        yield record
+
+
+def main():
+    if len(sys.argv) < 4:
+        print("usage: python merge_stream.py <output.csv> <window in ns> "
+              "<task files...>")
+        sys.exit(1)
+
+    window = 1e-9 * float(sys.argv[2])
+    ends = [end_time(file_name) for file_name in sys.argv[3:]]
+    cut = min(ends)
+    print("stream cut at %.6g s (task ends %.6g - %.6g s)" %
+          (cut, cut, max(ends)))
+    streams = [read_decays(file_name, task, cut)
+               for task, file_name in enumerate(sys.argv[3:])]
+
+    records = 0
+    with open(sys.argv[1], "w") as f:
+        writer = csv.writer(f)
+        writer.writerow(["t", "dt", "ed", "x", "y", "z", "ndeposits",
+                         "ndecays", "sources"])
+        for record in pile_up(merge_deposits(streams), window):
+            ed = record["ed"]
+            writer.writerow(["%.9f" % record["t"], "%.3e" % record["dt"],
+                             "%.3f" % ed, "%.2f" % (record["x"] / ed),
+                             "%.2f" % (record["y"] / ed),
+                             "%.2f" % (record["z"] / ed),
+                             record["ndeposits"], len(record["sources"]),
+                             " ".join("%d:%d" % s
+                                      for s in sorted(record["sources"]))])
+            records += 1
+    print("%d records in %.6g s written to %s" % (records, cut, sys.argv[1]))
+
+
+if __name__ == "__main__":
+    main()
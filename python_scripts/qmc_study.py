@@ -0,0 +1,149 @@
+#!/usr/bin/python
+#
+# Variance of pseudo-random vs scrambled-Sobol vertex/direction sampling
+# (/xe/gun/qmc/) for a few representative components, on a toy model of the
+# detector: uncollided gammas from the component, first interaction in the
+# FV, attenuation in LXe only. The Sobol points and the per-task digital
+# shift are the same as in Xenon1tQuasiRandom.cc.
+#
+# usage: python qmc_study.py [events per task] [tasks]
+# For the full simulation, run the same component with /xe/gun/qmc/setActive
+# true and false over the same number of array tasks and compare the spread
+# of the per-task FV rates in the same way.
+
+import math
+import random
+import sys
+
+##### INPUT PARAMETER #####
+
+N_EVENTS = int(sys.argv[1]) if len(sys.argv) > 1 else 4096
+N_TASKS = int(sys.argv[2]) if len(sys.argv) > 2 else 16
+
+MU_LXE = 0.0144          #1/mm, 1.33 MeV gammas in LXe
+LXE = (664., -1500., 0.)   #radius, zmin, zmax (mm)
+FV = (600., -1300., -200.)
+
+#component: (kind, radius, zmin, zmax) - "shell" is a cylindrical surface,
+#"disc" a horizontal disc at zmin
+component_array = {"SS_InnerCryostat": ("shell", 735., -1600., 100.),
+                "Copper_BottomPmtPlate": ("disc", 650., -1550., -1550.),
+                "Copper_TopPmtPlate": ("disc", 650., 50., 50.),
+                }
+##### ##### #####
+
+#Joe-Kuo direction numbers, as in Xenon1tQuasiRandom::InitialiseDirectionNumbers
+BITS = 32
+DEGREE = [0, 1, 2, 3, 3]
+COEFFICIENTS = [0, 0, 1, 1, 2]
+INITIAL = [[0, 0, 0], [1, 0, 0], [1, 3, 0], [1, 3, 1], [1, 1, 1]]
+
+
+def direction_numbers():
+    V = []
+    for d in range(len(DEGREE)):
+        s = DEGREE[d]
+        if s == 0:
+            V.append([1 << (BITS - 1 - i) for i in range(BITS)])
+            continue
+        v = [0] * BITS
+        for i in range(s):
+            v[i] = INITIAL[d][i] << (BITS - 1 - i)
+        for i in range(s, BITS):
+            v[i] = v[i - s] ^ (v[i - s] >> s)
+            for k in range(1, s):
+                if (COEFFICIENTS[d] >> (s - 1 - k)) & 1:
+                    v[i] ^= v[i - k]
+        V.append(v)
+    return V
+
+
+def sobol(n, dims, shifts, V):
+    x = [0] * dims
+    for i in range(n):
+        if i > 0:
+            c, j = 0, i - 1
+            while j & 1:
+                c += 1
+                j >>= 1
+            x = [x[d] ^ V[d][c] for d in range(dims)]
+        yield [((x[d] ^ shifts[d]) + 0.5) / 2.0**BITS for d in range(dims)]
+
+
+def pseudo(n, dims, rng):
+    for i in range(n):
+        yield [rng.random() for d in range(dims)]
+
+
+def cylinder_interval(p, u, cyl):
+    r, zmin, zmax = cyl
+    t0, t1 = 0., float("inf")
+    a = u[0] * u[0] + u[1] * u[1]
+    b = p[0] * u[0] + p[1] * u[1]
+    c = p[0] * p[0] + p[1] * p[1] - r * r
+    if a > 0.:
+        disc = b * b - a * c
+        if disc <= 0.:
+            return None
+        sq = math.sqrt(disc)
+        t0, t1 = max(t0, (-b - sq) / a), min(t1, (-b + sq) / a)
+    elif c > 0.:
+        return None
+    if u[2] != 0.:
+        ta, tb = (zmin - p[2]) / u[2], (zmax - p[2]) / u[2]
+        t0, t1 = max(t0, min(ta, tb)), min(t1, max(ta, tb))
+    elif not zmin <= p[2] <= zmax:
+        return None
+    return (t0, t1) if t1 > t0 else None
+
+
+def score(point, component):
+    kind, r, zmin, zmax = component
+    if kind == "shell":
+        phi = 2. * math.pi * point[0]
+        p = (r * math.cos(phi), r * math.sin(phi), zmin + (zmax - zmin) * point[1])
+    else:
+        rho, phi = r * math.sqrt(point[0]), 2. * math.pi * point[1]
+        p = (rho * math.cos(phi), rho * math.sin(phi), zmin)
+    cos_theta = 1. - 2. * point[3]
+    sin_theta = math.sqrt(1. - cos_theta * cos_theta)
+    phi = 2. * math.pi * point[4]
+    u = (sin_theta * math.cos(phi), sin_theta * math.sin(phi), cos_theta)
+
+    fv = cylinder_interval(p, u, FV)
+    lxe = cylinder_interval(p, u, LXE)
+    if fv is None or lxe is None:
+        return 0.
+    return math.exp(-MU_LXE * (fv[0] - lxe[0])) * (1. - math.exp(-MU_LXE * (fv[1] - fv[0])))
+
+
+def splitmix_shifts(task, dims):
+    mask = (1 << 64) - 1
+    state = (0x9E3779B97F4A7C15 * (task + 1)) & mask
+    shifts = []
+    for d in range(dims):
+        state = (state + 0x9E3779B97F4A7C15) & mask
+        z = state
+        z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & mask
+        z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & mask
+        shifts.append((z ^ (z >> 31)) >> 32)
+    return shifts
+
+
+def spread(values):
+    mean = sum(values) / len(values)
+    return mean, sum((v - mean)**2 for v in values) / (len(values) - 1)
+
+
+V = direction_numbers()
+print("%d events per task, %d tasks" % (N_EVENTS, N_TASKS))
+print("%-24s %12s %12s %12s %10s" % ("component", "mean", "std MC", "std QMC", "var ratio"))
+for COMPONENT_STRING, component in sorted(component_array.items()):
+    mc, qmc = [], []
+    for task in range(N_TASKS):
+        rng = random.Random(task)
+        mc.append(sum(score(x, component) for x in pseudo(N_EVENTS, 5, rng)) / N_EVENTS)
+        qmc.append(sum(score(x, component) for x in sobol(N_EVENTS, 5, splitmix_shifts(task, 5), V)) / N_EVENTS)
+    mean_mc, var_mc = spread(mc)
+    mean_qmc, var_qmc = spread(qmc)
+    print("%-24s %12.4e %12.4e %12.4e %10.1f" % (COMPONENT_STRING, mean_qmc, math.sqrt(var_mc), math.sqrt(var_qmc), var_mc / var_qmc if var_qmc > 0 else float("inf")))
@@ -0,0 +1,105 @@
+#!/usr/bin/python
+#
+# Validation of Woodcock tracking (/Xe/woodcock/setActive): xenon spectrum of
+# a run with delta tracking against the run of the same macro without it.
+# Make both with make_macros.py from the same component and isotope, once
+# with WOODCOCK = True and once with WOODCOCK = False (the switch goes in
+# preinit_ER.mac), with the other biasing switches off so that every event
+# counts once, and with different seeds. Delta tracking only changes the
+# number of steps of the gammas outside the excluded volume, so the two
+# spectra must agree within their statistical errors, in shape and in
+# rate per generated event. The run log of the Woodcock run must not report
+# majorant violations (Xenon1tWoodcockTracking::PrintStatistics).
+#
+# usage: python woodcock_study.py <woodcock run files...>
+#        -- <reference run files...>
+#
+# Per bin the two rates per generated event, their ratio and pull are
+# printed, then chi2/ndf over the filled bins; a chi2/ndf well above 1 or a
+# run of pulls of one sign in the low-energy (single scatter) bins is a bias.
+
+import sys
+
+import numpy as np
+
+##### INPUT PARAMETER #####
+
+TREE = "events/events"
+DEPOSIT_BRANCHES = ["ed"]            #keV
+BINS = np.linspace(0., 3000., 151)   #keV
+MIN_ENERGY = 0.                      #keV, events below are not counted
+##### ##### #####
+
+
+def event_energies(file_names):
+    #(summed deposit of the events with a deposit, number of events)
+    import uproot
+    energies = []
+    events = 0
+    for file_name in file_names:
+        for chunk in uproot.iterate(file_name + ":" + TREE, DEPOSIT_BRANCHES,
+                                    library="np"):
+            for deposits in chunk["ed"]:
+                events += 1
+                if len(deposits) > 0:
+                    energies.append(np.sum(deposits))
+    energies = np.array(energies)
+    return energies[energies > MIN_ENERGY], events
+
+
+def main():
+    if "--" not in sys.argv or sys.argv.index("--") < 2:
+        print("usage: python woodcock_study.py <woodcock run files...> "
+              "-- <reference run files...>")
+        sys.exit(1)
+
+    split = sys.argv.index("--")
+    woodcock_energies, woodcock_events = event_energies(sys.argv[1:split])
+    reference_energies, reference_events = event_energies(sys.argv[split + 1:])
+    if woodcock_events == 0 or reference_events == 0:
+        print("no events")
+        sys.exit(1)
+
+    #rates per generated event and keV
+    widths = np.diff(BINS)
+    woodcock_counts = np.histogram(woodcock_energies, BINS)[0]
+    reference_counts = np.histogram(reference_energies, BINS)[0]
+    woodcock_rate = woodcock_counts / float(woodcock_events) / widths
+    woodcock_error = np.sqrt(woodcock_counts) / float(woodcock_events) / widths
+    reference_rate = reference_counts / float(reference_events) / widths
+    reference_error = (np.sqrt(reference_counts) / float(reference_events) /
+                       widths)
+
+    print("%d Woodcock events, %d reference events" %
+          (woodcock_events, reference_events))
+    print("%10s %10s %12s %12s %8s %8s" % ("E_low", "E_high", "woodcock",
+                                           "reference", "ratio", "pull"))
+    chi2 = 0.
+    ndf = 0
+    for i in range(len(widths)):
+        if woodcock_counts[i] == 0 and reference_counts[i] == 0:
+            continue
+        sigma = np.sqrt(woodcock_error[i] ** 2 + reference_error[i] ** 2)
+        pull = (woodcock_rate[i] - reference_rate[i]) / sigma
+        ratio = (woodcock_rate[i] / reference_rate[i]
+                 if reference_counts[i] else float("inf"))
+        print("%10.1f %10.1f %12.4g %12.4g %8.3f %8.2f" %
+              (BINS[i], BINS[i + 1], woodcock_rate[i], reference_rate[i],
+               ratio, pull))
+        chi2 += pull ** 2
+        ndf += 1
+
+    woodcock_total = len(woodcock_energies) / float(woodcock_events)
+    reference_total = len(reference_energies) / float(reference_events)
+    print("events with a deposit per generated event: woodcock %.4g +- %.2g, "
+          "reference %.4g +- %.2g" %
+          (woodcock_total,
+           np.sqrt(len(woodcock_energies)) / float(woodcock_events),
+           reference_total,
+           np.sqrt(len(reference_energies)) / float(reference_events)))
+    if ndf:
+        print("chi2/ndf = %.1f/%d" % (chi2, ndf))
+
+
+if __name__ == "__main__":
+    main()